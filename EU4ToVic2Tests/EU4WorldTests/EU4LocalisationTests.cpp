@@ -0,0 +1,162 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/EU4World/Localisation/EU4Localisation.h"
+#include <filesystem>
+#include <fstream>
+namespace fs = std::filesystem;
+
+
+
+namespace
+{
+	void writeFile(const std::string& path, const std::string& content)
+	{
+		fs::create_directories(fs::path(path).parent_path());
+		std::ofstream(path, std::ios::binary) << content;
+	}
+}
+
+
+TEST(EU4World_EU4LocalisationTests, unknownKeysHaveNoText)
+{
+	const EU4::EU4Localisation localisation;
+
+	ASSERT_TRUE(localisation.getText("SWE", "english").empty());
+	ASSERT_TRUE(localisation.getTextInEachLanguage("SWE").empty());
+}
+
+
+TEST(EU4World_EU4LocalisationTests, languageComesFromTheFileHeader)
+{
+	writeFile("EU4LocalisationTestsLanguage/countries_l_english.yml", "l_french:\n SWE:0 \"Suède\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromFile("EU4LocalisationTestsLanguage/countries_l_english.yml");
+
+	ASSERT_EQ(localisation.getText("SWE", "french"), "Suède");
+	ASSERT_TRUE(localisation.getText("SWE", "english").empty());
+	fs::remove_all("EU4LocalisationTestsLanguage");
+}
+
+
+TEST(EU4World_EU4LocalisationTests, filesWithoutLanguageAreIgnored)
+{
+	writeFile("EU4LocalisationTestsNoLanguage/countries.yml", " SWE:0 \"Sweden\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromFile("EU4LocalisationTestsNoLanguage/countries.yml");
+
+	ASSERT_TRUE(localisation.getTextInEachLanguage("SWE").empty());
+	fs::remove_all("EU4LocalisationTestsNoLanguage");
+}
+
+
+TEST(EU4World_EU4LocalisationTests, byteOrderMarksAreSkipped)
+{
+	writeFile("EU4LocalisationTestsBOM/countries_l_english.yml", "\xEF\xBB\xBFl_english:\n SWE:0 \"Sweden\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromFile("EU4LocalisationTestsBOM/countries_l_english.yml");
+
+	ASSERT_EQ(localisation.getText("SWE", "english"), "Sweden");
+	fs::remove_all("EU4LocalisationTestsBOM");
+}
+
+
+TEST(EU4World_EU4LocalisationTests, textEndsAtItsFirstClosingQuote)
+{
+	writeFile("EU4LocalisationTestsQuotes/countries_l_english.yml", "l_english:\n SWE:0 \"Sweden\" # the \"Swedes\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromFile("EU4LocalisationTestsQuotes/countries_l_english.yml");
+
+	ASSERT_EQ(localisation.getText("SWE", "english"), "Sweden");
+	fs::remove_all("EU4LocalisationTestsQuotes");
+}
+
+
+TEST(EU4World_EU4LocalisationTests, linesWithoutTextAreSkipped)
+{
+	writeFile("EU4LocalisationTestsEmpty/countries_l_english.yml", "l_english:\n # Scandinavia\n SWE:0 \"\"\n\n DAN:0 \"Denmark\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromFile("EU4LocalisationTestsEmpty/countries_l_english.yml");
+
+	ASSERT_TRUE(localisation.getTextInEachLanguage("SWE").empty());
+	ASSERT_EQ(localisation.getText("DAN", "english"), "Denmark");
+	fs::remove_all("EU4LocalisationTestsEmpty");
+}
+
+
+TEST(EU4World_EU4LocalisationTests, laterDefinitionsInAFileWin)
+{
+	writeFile("EU4LocalisationTestsRepeat/countries_l_english.yml", "l_english:\n SWE:0 \"Sweden\"\n SWE:1 \"Svealand\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromFile("EU4LocalisationTestsRepeat/countries_l_english.yml");
+
+	ASSERT_EQ(localisation.getText("SWE", "english"), "Svealand");
+	fs::remove_all("EU4LocalisationTestsRepeat");
+}
+
+
+TEST(EU4World_EU4LocalisationTests, laterFilesInAFolderWin)
+{
+	writeFile("EU4LocalisationTestsFolder/a_l_english.yml", "l_english:\n SWE:0 \"Sweden\"\n DAN:0 \"Denmark\"\n");
+	writeFile("EU4LocalisationTestsFolder/b_l_english.yml", "l_english:\n SWE:0 \"Svealand\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromAllFilesInFolder("EU4LocalisationTestsFolder");
+
+	ASSERT_EQ(localisation.getText("SWE", "english"), "Svealand");
+	ASSERT_EQ(localisation.getText("DAN", "english"), "Denmark");
+	fs::remove_all("EU4LocalisationTestsFolder");
+}
+
+
+TEST(EU4World_EU4LocalisationTests, modTextsOverrideGameTexts)
+{
+	writeFile("EU4LocalisationTestsMod/game/localisation/countries_l_english.yml", "l_english:\n SWE:0 \"Sweden\"\n NOR:0 \"Norway\"\n");
+	writeFile("EU4LocalisationTestsMod/mod/localisation/my_countries_l_english.yml", "l_english:\n SWE:0 \"Sverige\"\n");
+	EU4::EU4Localisation localisation;
+	// The order readFromAllLocalisationFolders reads them in.
+	localisation.readFromAllFilesInFolder("EU4LocalisationTestsMod/game/localisation");
+	localisation.readFromAllFilesInFolder("EU4LocalisationTestsMod/mod/localisation");
+
+	ASSERT_EQ(localisation.getText("SWE", "english"), "Sverige");
+	ASSERT_EQ(localisation.getText("NOR", "english"), "Norway");
+	fs::remove_all("EU4LocalisationTestsMod");
+}
+
+
+TEST(EU4World_EU4LocalisationTests, textsComeInEachLanguageInReadOrder)
+{
+	writeFile("EU4LocalisationTestsEach/countries_l_english.yml", "l_english:\n SWE:0 \"Sweden\"\n");
+	writeFile("EU4LocalisationTestsEach/countries_l_french.yml", "l_french:\n SWE:0 \"Suède\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromAllFilesInFolder("EU4LocalisationTestsEach");
+
+	const auto& texts = localisation.getTextInEachLanguage("SWE");
+	ASSERT_EQ(texts.size(), 2);
+	ASSERT_EQ(texts[0].first, "english");
+	ASSERT_EQ(texts[0].second, "Sweden");
+	ASSERT_EQ(texts[1].first, "french");
+	ASSERT_EQ(texts[1].second, "Suède");
+	fs::remove_all("EU4LocalisationTestsEach");
+}
+
+
+TEST(EU4World_EU4LocalisationTests, foldersAreMergedAsIfReadOneFileAfterAnother)
+{
+	// Enough files for the pool to parse several at once, all defining the same keys.
+	std::vector<std::string> fileNames;
+	for (auto file = 0; file < 32; ++file)
+	{
+		const auto fileName = "EU4LocalisationTestsOrder/" + std::string(file < 10 ? "0" : "") + std::to_string(file) + "_l_english.yml";
+		writeFile(fileName, "l_english:\n SWE:0 \"Sweden " + std::to_string(file) + "\"\n KEY_" + std::to_string(file % 4) + ":0 \"Text " + std::to_string(file) + "\"\n");
+		fileNames.push_back(fileName);
+	}
+	EU4::EU4Localisation inParallel;
+	inParallel.readFromAllFilesInFolder("EU4LocalisationTestsOrder");
+	EU4::EU4Localisation oneByOne;
+	for (const auto& fileName: fileNames) oneByOne.readFromFile(fileName);
+
+	ASSERT_EQ(inParallel.getText("SWE", "english"), "Sweden 31");
+	for (const auto* key: {"SWE", "KEY_0", "KEY_1", "KEY_2", "KEY_3"})
+	{
+		ASSERT_EQ(inParallel.getText(key, "english"), oneByOne.getText(key, "english"));
+	}
+	fs::remove_all("EU4LocalisationTestsOrder");
+}
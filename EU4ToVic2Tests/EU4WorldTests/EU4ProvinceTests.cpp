@@ -101,7 +101,7 @@ TEST(EU4World_ProvinceTests, coresCanBeSetWithNewStyle)
 	input << "}";
 
 	EU4::Province theProvince("-1", input);
-	ASSERT_EQ(theProvince.getCores().count("TAG"), 1);
+	ASSERT_EQ(theProvince.getCores().count(helpers::Symbol("TAG")), 1);
 }
 
 
@@ -113,7 +113,7 @@ TEST(EU4World_ProvinceTests, coresCanBeSetWithOldStyle)
 	input << "}";
 
 	EU4::Province theProvince("-1", input);
-	ASSERT_EQ(theProvince.getCores().count("TAG"), 1);
+	ASSERT_EQ(theProvince.getCores().count(helpers::Symbol("TAG")), 1);
 }
 
 
@@ -125,7 +125,7 @@ TEST(EU4World_ProvinceTests, coresCanBeAdded)
 	EU4::Province theProvince("-1", input);
 	theProvince.addCore("TAG");
 
-	ASSERT_EQ(theProvince.getCores().count("TAG"), 1);
+	ASSERT_EQ(theProvince.getCores().count(helpers::Symbol("TAG")), 1);
 }
 
 
@@ -139,7 +139,7 @@ TEST(EU4World_ProvinceTests, coresCanBeRemoved)
 	EU4::Province theProvince("-1", input);
 	theProvince.removeCore("TAG");
 
-	ASSERT_EQ(theProvince.getCores().count("TAG"), 0);
+	ASSERT_EQ(theProvince.getCores().count(helpers::Symbol("TAG")), 0);
 }
 
 
@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/EU4World/Mods/ModDescriptorIndex.h"
+#include <filesystem>
+#include <fstream>
+namespace fs = std::filesystem;
+
+
+
+namespace
+{
+	void writeDescriptor(const std::string& path, const std::string& name)
+	{
+		fs::create_directories(fs::path(path).parent_path());
+		std::ofstream(path) << "name = \"" << name << "\"\npath = \"mod/" << name << "\"\n";
+	}
+}
+
+
+TEST(EU4World_ModDescriptorIndexTests, descriptorsAreRead)
+{
+	fs::remove_all("ModDescriptorIndexRead");
+	writeDescriptor("ModDescriptorIndexRead/a.mod", "first");
+	writeDescriptor("ModDescriptorIndexRead/b.mod", "second");
+
+	EU4::ModDescriptorIndex index("ModDescriptorIndexRead/index.txt");
+	const auto mods = index.read({"ModDescriptorIndexRead/a.mod", "ModDescriptorIndexRead/missing.mod", "ModDescriptorIndexRead/b.mod"});
+
+	ASSERT_EQ(mods.size(), 3);
+	ASSERT_EQ(mods[0]->getName(), "first");
+	ASSERT_EQ(mods[0]->getPath(), "mod/first");
+	ASSERT_FALSE(mods[1]);
+	ASSERT_EQ(mods[2]->getName(), "second");
+	fs::remove_all("ModDescriptorIndexRead");
+}
+
+
+TEST(EU4World_ModDescriptorIndexTests, unchangedDescriptorsComeFromTheSavedIndex)
+{
+	fs::remove_all("ModDescriptorIndexSaved");
+	writeDescriptor("ModDescriptorIndexSaved/a.mod", "first");
+	const auto modified = fs::last_write_time("ModDescriptorIndexSaved/a.mod");
+	{
+		EU4::ModDescriptorIndex index("ModDescriptorIndexSaved/index.txt");
+		ASSERT_EQ(index.read({"ModDescriptorIndexSaved/a.mod"})[0]->getName(), "first");
+		index.save();
+	}
+
+	// Same size and time, so only the index can know the old name.
+	writeDescriptor("ModDescriptorIndexSaved/a.mod", "other");
+	fs::last_write_time("ModDescriptorIndexSaved/a.mod", modified);
+
+	EU4::ModDescriptorIndex index("ModDescriptorIndexSaved/index.txt");
+	ASSERT_EQ(index.read({"ModDescriptorIndexSaved/a.mod"})[0]->getName(), "first");
+	fs::remove_all("ModDescriptorIndexSaved");
+}
+
+
+TEST(EU4World_ModDescriptorIndexTests, changedDescriptorsAreReadAgain)
+{
+	fs::remove_all("ModDescriptorIndexChanged");
+	writeDescriptor("ModDescriptorIndexChanged/a.mod", "first");
+	const auto modified = fs::last_write_time("ModDescriptorIndexChanged/a.mod");
+	{
+		EU4::ModDescriptorIndex index("ModDescriptorIndexChanged/index.txt");
+		ASSERT_EQ(index.read({"ModDescriptorIndexChanged/a.mod"})[0]->getName(), "first");
+		index.save();
+	}
+
+	writeDescriptor("ModDescriptorIndexChanged/a.mod", "updated");
+	fs::last_write_time("ModDescriptorIndexChanged/a.mod", modified + std::chrono::hours(1));
+
+	EU4::ModDescriptorIndex index("ModDescriptorIndexChanged/index.txt");
+	ASSERT_EQ(index.read({"ModDescriptorIndexChanged/a.mod"})[0]->getName(), "updated");
+	fs::remove_all("ModDescriptorIndexChanged");
+}
+
+
+TEST(EU4World_ModDescriptorIndexTests, savingLeavesOtherTemporaryFilesAlone)
+{
+	fs::remove_all("ModDescriptorIndexShared");
+	writeDescriptor("ModDescriptorIndexShared/a.mod", "first");
+	// As left by another run saving the same index.
+	std::ofstream("ModDescriptorIndexShared/index.txt.tmp") << "half";
+	{
+		EU4::ModDescriptorIndex index("ModDescriptorIndexShared/index.txt");
+		ASSERT_EQ(index.read({"ModDescriptorIndexShared/a.mod"})[0]->getName(), "first");
+		index.save();
+	}
+
+	ASSERT_EQ(fs::file_size("ModDescriptorIndexShared/index.txt.tmp"), 4);
+	ASSERT_EQ(std::distance(fs::directory_iterator("ModDescriptorIndexShared"), fs::directory_iterator()), 3);
+	EU4::ModDescriptorIndex index("ModDescriptorIndexShared/index.txt");
+	ASSERT_EQ(index.read({"ModDescriptorIndexShared/a.mod"})[0]->getName(), "first");
+	fs::remove_all("ModDescriptorIndexShared");
+}
@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/EU4World/Mods/ModExtractionCache.h"
+#include <filesystem>
+#include <fstream>
+namespace fs = std::filesystem;
+
+
+
+namespace
+{
+	void writeFile(const std::string& path, const std::string& content)
+	{
+		fs::create_directories(fs::path(path).parent_path());
+		std::ofstream(path, std::ios::binary) << content;
+	}
+
+	// Stands in for unzipping: copies the "archive" into the target as a single file.
+	bool fakeExtract(const std::string& archivePath, const std::string& targetPath)
+	{
+		std::ifstream archive(archivePath, std::ios::binary);
+		const std::string content{std::istreambuf_iterator<char>(archive), std::istreambuf_iterator<char>()};
+		writeFile(targetPath + "/content.txt", content);
+		return true;
+	}
+
+	std::string readContent(const std::string& folder)
+	{
+		std::ifstream file(folder + "/content.txt", std::ios::binary);
+		return std::string{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+	}
+}
+
+
+TEST(EU4World_ModExtractionCacheTests, missingExtractionIsNotUpToDate)
+{
+	fs::remove_all("ModExtractionCacheMissing");
+	writeFile("ModExtractionCacheMissing/mod.zip", "first");
+	const EU4::ModExtractionCache cache("ModExtractionCacheMissing/mod.zip", "ModExtractionCacheMissing/mod");
+
+	ASSERT_FALSE(cache.isUpToDate());
+	fs::remove_all("ModExtractionCacheMissing");
+}
+
+
+TEST(EU4World_ModExtractionCacheTests, refreshedExtractionIsUpToDate)
+{
+	fs::remove_all("ModExtractionCacheRefresh");
+	writeFile("ModExtractionCacheRefresh/mod.zip", "first");
+	const EU4::ModExtractionCache cache("ModExtractionCacheRefresh/mod.zip", "ModExtractionCacheRefresh/mod");
+
+	ASSERT_TRUE(cache.refresh(fakeExtract));
+
+	ASSERT_TRUE(cache.isUpToDate());
+	ASSERT_EQ(readContent("ModExtractionCacheRefresh/mod"), "first");
+	fs::remove_all("ModExtractionCacheRefresh");
+}
+
+
+TEST(EU4World_ModExtractionCacheTests, unstampedFoldersAreNotTrusted)
+{
+	fs::remove_all("ModExtractionCacheUnstamped");
+	writeFile("ModExtractionCacheUnstamped/mod.zip", "first");
+	writeFile("ModExtractionCacheUnstamped/mod/content.txt", "half");
+	const EU4::ModExtractionCache cache("ModExtractionCacheUnstamped/mod.zip", "ModExtractionCacheUnstamped/mod");
+
+	ASSERT_FALSE(cache.isUpToDate());
+	fs::remove_all("ModExtractionCacheUnstamped");
+}
+
+
+TEST(EU4World_ModExtractionCacheTests, changedArchiveIsNotUpToDate)
+{
+	fs::remove_all("ModExtractionCacheChanged");
+	writeFile("ModExtractionCacheChanged/mod.zip", "first");
+	const EU4::ModExtractionCache cache("ModExtractionCacheChanged/mod.zip", "ModExtractionCacheChanged/mod");
+	ASSERT_TRUE(cache.refresh(fakeExtract));
+
+	writeFile("ModExtractionCacheChanged/mod.zip", "second, longer");
+	ASSERT_FALSE(cache.isUpToDate());
+
+	ASSERT_TRUE(cache.refresh(fakeExtract));
+	ASSERT_EQ(readContent("ModExtractionCacheChanged/mod"), "second, longer");
+	fs::remove_all("ModExtractionCacheChanged");
+}
+
+
+TEST(EU4World_ModExtractionCacheTests, touchedButUnchangedArchiveIsUpToDate)
+{
+	fs::remove_all("ModExtractionCacheTouched");
+	writeFile("ModExtractionCacheTouched/mod.zip", "first");
+	const EU4::ModExtractionCache cache("ModExtractionCacheTouched/mod.zip", "ModExtractionCacheTouched/mod");
+	ASSERT_TRUE(cache.refresh(fakeExtract));
+
+	fs::last_write_time("ModExtractionCacheTouched/mod.zip", fs::last_write_time("ModExtractionCacheTouched/mod.zip") + std::chrono::hours(1));
+
+	ASSERT_TRUE(cache.isUpToDate());
+	fs::remove_all("ModExtractionCacheTouched");
+}
+
+
+TEST(EU4World_ModExtractionCacheTests, failedRefreshKeepsPreviousExtraction)
+{
+	fs::remove_all("ModExtractionCacheFailed");
+	writeFile("ModExtractionCacheFailed/mod.zip", "first");
+	const EU4::ModExtractionCache cache("ModExtractionCacheFailed/mod.zip", "ModExtractionCacheFailed/mod");
+	ASSERT_TRUE(cache.refresh(fakeExtract));
+
+	ASSERT_FALSE(cache.refresh([](const std::string& archivePath, const std::string& targetPath) { return false; }));
+
+	ASSERT_EQ(readContent("ModExtractionCacheFailed/mod"), "first");
+	ASSERT_EQ(std::distance(fs::directory_iterator("ModExtractionCacheFailed"), fs::directory_iterator()), 2);
+	fs::remove_all("ModExtractionCacheFailed");
+}
@@ -177,3 +177,35 @@ TEST(EU4World_ProvinceHistoryTests, wasNotColonizedIfCultureDidntChange)
 	ASSERT_FALSE(theHistory.wasColonized());
 }
 
+
+
+TEST(EU4World_ProvinceHistoryTests, datedEntriesAreReadInSaveOrder)
+{
+	std::stringstream input;
+	input << "={\n";
+	input << "	1700.1.1={\n";
+	input << "		owner=SECOND\n";
+	input << "	}\n";
+	input << "	base_tax=3\n";
+	input << "	1600.1.1={\n";
+	input << "		owner=FIRST\n";
+	input << "		controller={ tag=FIRST }\n";
+	input << "	}\n";
+	input << "}";
+
+	const EU4::ProvinceHistory theHistory(input);
+	ASSERT_EQ(theHistory.getOriginalDevelopment(), 3);
+	ASSERT_EQ(theHistory.getFirstOwnedDate(), date("1700.1.1"));
+}
+
+
+TEST(EU4World_ProvinceHistoryTests, startingReligionDoesNotReplaceStartingCulture)
+{
+	std::stringstream input;
+	input << "={}";
+
+	EU4::ProvinceHistory theHistory(input);
+	theHistory.setStartingCulture("theCulture");
+	theHistory.setStartingReligion("theReligion");
+	ASSERT_EQ(theHistory.getOriginalCulture(), "theCulture");
+}
@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/EU4World/SaveSnapshot/SaveSnapshot.h"
+#include "../EU4toV2/Source/Helpers/ViewStream.h"
+#include "ParserHelpers.h"
+#include <filesystem>
+#include <fstream>
+namespace fs = std::filesystem;
+
+
+
+namespace
+{
+	void writeFile(const std::string& path, const std::string& content)
+	{
+		fs::create_directories(fs::path(path).parent_path());
+		std::ofstream(path, std::ios::binary) << content;
+	}
+
+	std::string readFile(const std::string& path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		return std::string{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+	}
+
+	// The save header keys as the world reads them, each handed over through the snapshot.
+	class SaveHeader: commonItems::parser
+	{
+	public:
+		SaveHeader(const std::string& save, EU4::SaveSnapshot& snapshot)
+		{
+			const auto kept = [&snapshot](const commonItems::parsingFunction& handler) -> commonItems::parsingFunction
+			{
+				return [&snapshot, handler](const std::string& key, std::istream& theStream) { snapshot.keep(key, theStream, handler); };
+			};
+			registerKeyword("EU4txt", [](const std::string& unused, std::istream& theStream) {});
+			registerKeyword("date", kept([this](const std::string& unused, std::istream& theStream)
+				{
+					const commonItems::singleString dateString(theStream);
+					lastDate = dateString.getString();
+				}));
+			registerRegex("(multiplayer_)?random_seed", kept([this](const std::string& unused, std::istream& theStream)
+				{
+					const commonItems::singleString randomSeed(theStream);
+					seed = stoi(randomSeed.getString().substr(randomSeed.getString().size() - 5));
+				}));
+			registerKeyword("mod_enabled", kept([this](const std::string& unused, std::istream& theStream)
+				{
+					const commonItems::stringList modList(theStream);
+					mods = modList.getStrings();
+				}));
+			registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
+
+			helpers::ViewStream saveStream(save);
+			parseStream(saveStream);
+			clearRegisteredKeywords();
+		}
+
+		std::string lastDate;
+		int seed = 0;
+		std::vector<std::string> mods;
+	};
+
+	const std::string testSave = "EU4txt\n"
+		"date=1444.11.11\n"
+		"random_seed=123456789\n"
+		"mod_enabled={\n\t\"mod/first.mod\"\n\t\"mod/second.mod\"\n}\n"
+		"gameplaysettings={\n\tsetgameplayoptions={ 1 0 1 }\n}\n";
+}
+
+
+TEST(EU4World_SaveSnapshotTests, recordedSavesAreReadAsBefore)
+{
+	writeFile("SaveSnapshotTestsRecord/test.eu4", testSave);
+	EU4::SaveSnapshot snapshot("SaveSnapshotTestsRecord/test.eu4");
+	snapshot.startRecording();
+
+	const SaveHeader header(testSave, snapshot);
+	snapshot.finishRecording();
+
+	ASSERT_EQ(header.lastDate, "1444.11.11");
+	ASSERT_EQ(header.seed, 56789);
+	ASSERT_EQ(header.mods, std::vector<std::string>({"mod/first.mod", "mod/second.mod"}));
+	fs::remove(snapshot.getPath());
+	fs::remove_all("SaveSnapshotTestsRecord");
+}
+
+
+TEST(EU4World_SaveSnapshotTests, snapshotsReplayWhatWasRecorded)
+{
+	writeFile("SaveSnapshotTestsReplay/test.eu4", testSave);
+	{
+		EU4::SaveSnapshot snapshot("SaveSnapshotTestsReplay/test.eu4");
+		snapshot.startRecording();
+		const SaveHeader header(testSave, snapshot);
+		snapshot.finishRecording();
+	}
+
+	EU4::SaveSnapshot snapshot("SaveSnapshotTestsReplay/test.eu4");
+	ASSERT_TRUE(snapshot.exists());
+	const auto recorded = readFile(snapshot.getPath());
+	const SaveHeader header(recorded, snapshot);
+
+	ASSERT_EQ(recorded.find("gameplaysettings"), std::string::npos);
+	ASSERT_EQ(header.lastDate, "1444.11.11");
+	ASSERT_EQ(header.seed, 56789);
+	ASSERT_EQ(header.mods, std::vector<std::string>({"mod/first.mod", "mod/second.mod"}));
+	fs::remove(snapshot.getPath());
+	fs::remove_all("SaveSnapshotTestsReplay");
+}
@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/ContentHash.h"
+#include <string>
+
+
+
+TEST(Helpers_ContentHashTests, sameContentGivesSameHash)
+{
+	helpers::ContentHash first;
+	first.update("date=1444.11.11\nprovinces={}");
+	helpers::ContentHash second;
+	second.update("date=1444.11.11\nprovinces={}");
+
+	ASSERT_EQ(first.getValue(), second.getValue());
+}
+
+
+TEST(Helpers_ContentHashTests, contentCanBeHashedInPieces)
+{
+	std::string content;
+	for (auto count = 0; count < 100; ++count) content += "-" + std::to_string(count * 7919) + " = { block }";
+
+	helpers::ContentHash whole;
+	whole.update(content);
+
+	helpers::ContentHash pieces;
+	for (size_t position = 0; position < content.size(); position += 13) pieces.update(std::string_view(content).substr(position, 13));
+
+	ASSERT_EQ(whole.getValue(), pieces.getValue());
+}
+
+
+TEST(Helpers_ContentHashTests, anyChangedByteChangesTheHash)
+{
+	const std::string content(100, 'a');
+	helpers::ContentHash original;
+	original.update(content);
+
+	for (size_t position = 0; position < content.size(); ++position)
+	{
+		auto changed = content;
+		changed[position] = 'b';
+		helpers::ContentHash changedHash;
+		changedHash.update(changed);
+		ASSERT_NE(original.getValue(), changedHash.getValue());
+	}
+}
+
+
+TEST(Helpers_ContentHashTests, lengthChangesTheHash)
+{
+	helpers::ContentHash shorter;
+	shorter.update(std::string(31, '\0'));
+	helpers::ContentHash longer;
+	longer.update(std::string(32, '\0'));
+
+	ASSERT_NE(shorter.getValue(), longer.getValue());
+}
+
+
+TEST(Helpers_ContentHashTests, hashIsWrittenAsSixteenHexDigits)
+{
+	helpers::ContentHash hash;
+	hash.update("EU4txt");
+
+	const auto text = hash.toString();
+	ASSERT_EQ(text.size(), 16);
+	ASSERT_EQ(text.find_first_not_of("0123456789abcdef"), std::string::npos);
+}
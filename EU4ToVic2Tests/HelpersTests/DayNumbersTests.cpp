@@ -0,0 +1,52 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/DayNumbers.h"
+
+
+
+TEST(Helpers_DayNumbersTests, datesAreReadFromText)
+{
+	ASSERT_EQ(helpers::parseDayNumber("1444.11.11"), helpers::toDayNumber(1444, 11, 11));
+	ASSERT_EQ(helpers::parseDayNumber("1.1.1"), 365);
+}
+
+
+TEST(Helpers_DayNumbersTests, otherTextIsNotADate)
+{
+	ASSERT_FALSE(helpers::parseDayNumber("owner"));
+	ASSERT_FALSE(helpers::parseDayNumber("1444.11"));
+	ASSERT_FALSE(helpers::parseDayNumber("1444.11.11.1"));
+	ASSERT_FALSE(helpers::parseDayNumber("1444.11.11a"));
+	ASSERT_FALSE(helpers::parseDayNumber(".11.11"));
+	ASSERT_FALSE(helpers::parseDayNumber(""));
+}
+
+
+TEST(Helpers_DayNumbersTests, dayNumbersOrderLikeDates)
+{
+	ASSERT_LT(helpers::toDayNumber(1444, 11, 11), helpers::toDayNumber(1444, 11, 12));
+	ASSERT_LT(helpers::toDayNumber(1444, 11, 30), helpers::toDayNumber(1444, 12, 1));
+	ASSERT_LT(helpers::toDayNumber(1444, 12, 31), helpers::toDayNumber(1445, 1, 1));
+	ASSERT_EQ(helpers::toDayNumber(1445, 1, 1) - helpers::toDayNumber(1444, 12, 31), 1);
+}
+
+
+TEST(Helpers_DayNumbersTests, dayNumbersConvertBackToDates)
+{
+	const auto theDate = helpers::toDate(helpers::toDayNumber(1444, 12, 31));
+	ASSERT_EQ(theDate.getYear(), 1444);
+	ASSERT_EQ(theDate.getMonth(), 12);
+	ASSERT_EQ(theDate.getDay(), 31);
+
+	const auto firstDay = helpers::toDate(helpers::toDayNumber(1821, 1, 1));
+	ASSERT_EQ(firstDay.getYear(), 1821);
+	ASSERT_EQ(firstDay.getMonth(), 1);
+	ASSERT_EQ(firstDay.getDay(), 1);
+}
+
+
+TEST(Helpers_DayNumbersTests, yearsBetweenCountsWholeAndPartialYears)
+{
+	ASSERT_FLOAT_EQ(helpers::yearsBetween(helpers::toDayNumber(1500, 1, 1), helpers::toDayNumber(1444, 1, 1)), 56.0f);
+	ASSERT_FLOAT_EQ(helpers::yearsBetween(helpers::toDayNumber(1445, 1, 1), helpers::toDayNumber(1444, 12, 31)), 1.0f / 365);
+	ASSERT_FLOAT_EQ(helpers::yearsBetween(helpers::toDayNumber(1444, 1, 1), helpers::toDayNumber(1445, 1, 1)), -1.0f);
+}
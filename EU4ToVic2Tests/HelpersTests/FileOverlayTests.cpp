@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/FileOverlay.h"
+#include <filesystem>
+#include <fstream>
+namespace fs = std::filesystem;
+
+
+
+namespace
+{
+	void writeFile(const std::string& path)
+	{
+		fs::create_directories(fs::path(path).parent_path());
+		std::ofstream(path) << path;
+	}
+
+	// A game install and two mods, the first overriding one religion file, the second the areas.
+	std::string makeTestTree(const std::string& root)
+	{
+		fs::remove_all(root);
+		writeFile(root + "/game/common/religions/00_religion.txt");
+		writeFile(root + "/game/common/religions/01_extra.txt");
+		writeFile(root + "/game/map/area.txt");
+		writeFile(root + "/modA/common/religions/00_religion.txt");
+		writeFile(root + "/modA/common/religions/02_mod.txt");
+		writeFile(root + "/modB/map/area.txt");
+		return root;
+	}
+}
+
+
+TEST(Helpers_FileOverlayTests, laterRootsWinForTheSamePath)
+{
+	const auto root = makeTestTree("FileOverlayTestsWinners");
+	const helpers::FileOverlay overlay({root + "/game", root + "/modA", root + "/modB"});
+
+	ASSERT_EQ(*overlay.resolve("map/area.txt"), root + "/modB/map/area.txt");
+	ASSERT_EQ(*overlay.resolve("common/religions/01_extra.txt"), root + "/game/common/religions/01_extra.txt");
+	fs::remove_all(root);
+}
+
+
+TEST(Helpers_FileOverlayTests, missingFilesResolveToNothing)
+{
+	const auto root = makeTestTree("FileOverlayTestsMissing");
+	const helpers::FileOverlay overlay({root + "/game", root + "/modA"});
+
+	ASSERT_FALSE(overlay.resolve("map/region.txt"));
+	ASSERT_FALSE(overlay.resolve("nowhere/area.txt"));
+	fs::remove_all(root);
+}
+
+
+TEST(Helpers_FileOverlayTests, listingGivesWinnersInLoadOrder)
+{
+	const auto root = makeTestTree("FileOverlayTestsListing");
+	const helpers::FileOverlay overlay({root + "/game", root + "/modA", root + "/modB"});
+
+	const auto files = overlay.list("common/religions/");
+
+	ASSERT_EQ(files.size(), 3);
+	ASSERT_EQ(files[0], root + "/game/common/religions/01_extra.txt");
+	ASSERT_EQ(files[1], root + "/modA/common/religions/00_religion.txt");
+	ASSERT_EQ(files[2], root + "/modA/common/religions/02_mod.txt");
+	fs::remove_all(root);
+}
+
+
+TEST(Helpers_FileOverlayTests, foldersAreListedOnlyOnce)
+{
+	const auto root = makeTestTree("FileOverlayTestsCaching");
+	const helpers::FileOverlay overlay({root + "/game", root + "/modA"});
+	ASSERT_EQ(overlay.list("common/religions").size(), 3);
+
+	writeFile(root + "/modA/common/religions/03_late.txt");
+
+	ASSERT_EQ(overlay.list("common/religions").size(), 3);
+	fs::remove_all(root);
+}
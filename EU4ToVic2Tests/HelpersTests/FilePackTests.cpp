@@ -0,0 +1,155 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/FilePack.h"
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+namespace fs = std::filesystem;
+
+
+
+namespace
+{
+	void writeFile(const std::string& path, const std::string& content)
+	{
+		fs::create_directories(fs::path(path).parent_path());
+		std::ofstream(path, std::ios::binary) << content;
+	}
+}
+
+
+TEST(Helpers_FilePackTests, filesAreReadFromDisk)
+{
+	fs::remove_all("FilePackTestsDisk");
+	writeFile("FilePackTestsDisk/a.txt", "alpha");
+	helpers::FilePack pack("FilePackTestsDisk/files.pack");
+
+	ASSERT_EQ(*pack.read("FilePackTestsDisk/a.txt"), "alpha");
+	ASSERT_FALSE(pack.read("FilePackTestsDisk/missing.txt"));
+	fs::remove_all("FilePackTestsDisk");
+}
+
+
+TEST(Helpers_FilePackTests, unchangedFilesComeFromThePack)
+{
+	fs::remove_all("FilePackTestsPacked");
+	writeFile("FilePackTestsPacked/a.txt", "alpha");
+	const auto modified = fs::last_write_time("FilePackTestsPacked/a.txt");
+	{
+		helpers::FilePack pack("FilePackTestsPacked/files.pack");
+		ASSERT_EQ(*pack.read("FilePackTestsPacked/a.txt"), "alpha");
+		pack.save();
+	}
+
+	// Same size and time, so only the pack can know the old contents.
+	writeFile("FilePackTestsPacked/a.txt", "gamma");
+	fs::last_write_time("FilePackTestsPacked/a.txt", modified);
+
+	helpers::FilePack pack("FilePackTestsPacked/files.pack");
+	ASSERT_EQ(*pack.read("FilePackTestsPacked/a.txt"), "alpha");
+	fs::remove_all("FilePackTestsPacked");
+}
+
+
+TEST(Helpers_FilePackTests, changedFilesAreReadAgain)
+{
+	fs::remove_all("FilePackTestsChanged");
+	writeFile("FilePackTestsChanged/a.txt", "alpha");
+	{
+		helpers::FilePack pack("FilePackTestsChanged/files.pack");
+		ASSERT_EQ(*pack.read("FilePackTestsChanged/a.txt"), "alpha");
+		pack.save();
+	}
+
+	writeFile("FilePackTestsChanged/a.txt", "alpha and beta");
+
+	helpers::FilePack pack("FilePackTestsChanged/files.pack");
+	ASSERT_EQ(*pack.read("FilePackTestsChanged/a.txt"), "alpha and beta");
+	fs::remove_all("FilePackTestsChanged");
+}
+
+
+TEST(Helpers_FilePackTests, packCanBeReadAgainAfterSaving)
+{
+	fs::remove_all("FilePackTestsReused");
+	writeFile("FilePackTestsReused/a.txt", "alpha");
+	const auto modified = fs::last_write_time("FilePackTestsReused/a.txt");
+	helpers::FilePack pack("FilePackTestsReused/files.pack");
+	ASSERT_EQ(*pack.read("FilePackTestsReused/a.txt"), "alpha");
+	pack.save();
+
+	// Same size and time, so the contents have to come from the pack just written.
+	writeFile("FilePackTestsReused/a.txt", "gamma");
+	fs::last_write_time("FilePackTestsReused/a.txt", modified);
+
+	ASSERT_EQ(*pack.read("FilePackTestsReused/a.txt"), "alpha");
+	pack.save();
+	fs::remove_all("FilePackTestsReused");
+}
+
+
+TEST(Helpers_FilePackTests, savingLeavesOtherTemporaryFilesAlone)
+{
+	fs::remove_all("FilePackTestsShared");
+	writeFile("FilePackTestsShared/a.txt", "alpha");
+	// As left by another run writing the same pack.
+	writeFile("FilePackTestsShared/files.pack.tmp", "half");
+	{
+		helpers::FilePack pack("FilePackTestsShared/files.pack");
+		ASSERT_EQ(*pack.read("FilePackTestsShared/a.txt"), "alpha");
+		pack.save();
+	}
+
+	ASSERT_EQ(fs::file_size("FilePackTestsShared/files.pack.tmp"), 4);
+	ASSERT_EQ(std::distance(fs::directory_iterator("FilePackTestsShared"), fs::directory_iterator()), 3);
+	helpers::FilePack pack("FilePackTestsShared/files.pack");
+	ASSERT_EQ(*pack.read("FilePackTestsShared/a.txt"), "alpha");
+	fs::remove_all("FilePackTestsShared");
+}
+
+
+TEST(Helpers_FilePackTests, streamsSkipTheBOM)
+{
+	fs::remove_all("FilePackTestsBOM");
+	writeFile("FilePackTestsBOM/a.txt", "\xEF\xBB\xBFkey = value");
+	helpers::FilePack pack("FilePackTestsBOM/files.pack");
+
+	std::string key;
+	*pack.open("FilePackTestsBOM/a.txt") >> key;
+
+	ASSERT_EQ(key, "key");
+	fs::remove_all("FilePackTestsBOM");
+}
+
+
+TEST(Helpers_FilePackTests, missingFilesCanBeTriedWithoutFailing)
+{
+	fs::remove_all("FilePackTestsTry");
+	writeFile("FilePackTestsTry/a.txt", "key = value");
+	helpers::FilePack pack("FilePackTestsTry/files.pack");
+
+	ASSERT_EQ(pack.tryOpen("FilePackTestsTry/missing.txt"), nullptr);
+	ASSERT_NE(pack.tryOpen("FilePackTestsTry/a.txt"), nullptr);
+	fs::remove_all("FilePackTestsTry");
+}
+
+
+TEST(Helpers_FilePackTests, filesCanBeReadFromSeveralThreads)
+{
+	fs::remove_all("FilePackTestsThreads");
+	for (auto file = 0; file < 16; ++file) writeFile("FilePackTestsThreads/" + std::to_string(file) + ".txt", std::to_string(file));
+	helpers::FilePack pack("FilePackTestsThreads/files.pack");
+
+	std::vector<std::thread> readers;
+	std::vector<std::string> results(64);
+	for (auto reader = 0; reader < 4; ++reader)
+		readers.emplace_back([&pack, &results, reader] {
+			for (auto file = 0; file < 16; ++file)
+				results[reader * 16 + file] = std::string(*pack.read("FilePackTestsThreads/" + std::to_string(file) + ".txt"));
+		});
+	for (auto& reader: readers) reader.join();
+
+	for (auto index = 0; index < 64; ++index) ASSERT_EQ(results[index], std::to_string(index % 16));
+	pack.save();
+	fs::remove_all("FilePackTestsThreads");
+}
@@ -0,0 +1,91 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/KeywordTable.h"
+#include "ParserHelpers.h"
+#include <sstream>
+
+namespace
+{
+	struct Target
+	{
+		std::string name;
+		std::vector<std::string> children;
+		int level = 0;
+	};
+
+	void registerTargetKeywords(helpers::KeywordTable<Target, int>& keywords)
+	{
+		keywords.registerKeyword("name", [](Target& target, const int& unused, const std::string& key, std::istream& theStream)
+			{
+				const commonItems::singleString nameStr(theStream);
+				target.name = nameStr.getString();
+			});
+		keywords.registerKeyword("level", [](Target& target, const int& bonus, const std::string& key, std::istream& theStream)
+			{
+				const commonItems::singleInt levelInt(theStream);
+				target.level = levelInt.getInt() + bonus;
+			});
+		keywords.registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	}
+}
+
+
+
+TEST(Helpers_KeywordTableTests, handlersFillTheBoundTarget)
+{
+	helpers::KeywordTable<Target, int> keywords(registerTargetKeywords);
+	std::stringstream input;
+	input << "= { name = first level = 2 other = { name = ignored } }";
+
+	Target target;
+	keywords.parse(target, 10, input);
+
+	ASSERT_EQ(target.name, "first");
+	ASSERT_EQ(target.level, 12);
+}
+
+
+TEST(Helpers_KeywordTableTests, tableCanBeReusedForSeveralTargets)
+{
+	helpers::KeywordTable<Target, int> keywords(registerTargetKeywords);
+	std::stringstream firstInput;
+	firstInput << "= { name = first }";
+	std::stringstream secondInput;
+	secondInput << "= { level = 3 }";
+
+	Target first;
+	keywords.parse(first, 0, firstInput);
+	Target second;
+	keywords.parse(second, 0, secondInput);
+
+	ASSERT_EQ(first.name, "first");
+	ASSERT_EQ(first.level, 0);
+	ASSERT_TRUE(second.name.empty());
+	ASSERT_EQ(second.level, 3);
+}
+
+
+TEST(Helpers_KeywordTableTests, nestedTargetsOfTheSameTypeCanBeParsed)
+{
+	helpers::KeywordTable<Target, int> keywords([](helpers::KeywordTable<Target, int>& table)
+		{
+			table.registerKeyword("name", [](Target& target, const int& unused, const std::string& key, std::istream& theStream)
+				{
+					const commonItems::singleString nameStr(theStream);
+					target.name = nameStr.getString();
+				});
+			table.registerKeyword("child", [&table](Target& target, const int& depth, const std::string& key, std::istream& theStream)
+				{
+					Target child;
+					table.parse(child, depth + 1, theStream);
+					target.children.push_back(child.name);
+				});
+		});
+	std::stringstream input;
+	input << "= { child = { name = inner } name = outer }";
+
+	Target target;
+	keywords.parse(target, 0, input);
+
+	ASSERT_EQ(target.name, "outer");
+	ASSERT_EQ(target.children, std::vector<std::string>{"inner"});
+}
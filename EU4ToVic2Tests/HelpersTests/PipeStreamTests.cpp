@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/PipeStream.h"
+#include <sstream>
+#include <stdexcept>
+
+
+
+TEST(Helpers_PipeStreamTests, emptyProducerGivesEmptyStream)
+{
+	helpers::PipeStream input([](helpers::ChunkPipe& pipe) {});
+
+	std::string token;
+	input >> token;
+
+	ASSERT_TRUE(token.empty());
+	ASSERT_TRUE(input.eof());
+}
+
+
+TEST(Helpers_PipeStreamTests, chunksAreReadInOrder)
+{
+	helpers::PipeStream input([](helpers::ChunkPipe& pipe)
+		{
+			pipe.push("first ");
+			pipe.push("");
+			pipe.push("sec");
+			pipe.push("ond third");
+		}, 1);
+
+	std::string first, second, third;
+	input >> first >> second >> third;
+
+	ASSERT_EQ(first, "first");
+	ASSERT_EQ(second, "second");
+	ASSERT_EQ(third, "third");
+}
+
+
+TEST(Helpers_PipeStreamTests, charactersCanBePutBackAcrossChunks)
+{
+	helpers::PipeStream input([](helpers::ChunkPipe& pipe)
+		{
+			pipe.push("ab");
+			pipe.push("cd");
+		}, 1);
+
+	char character;
+	input.get(character);
+	input.get(character);
+	input.get(character);
+	ASSERT_EQ(character, 'c');
+
+	input.putback(character);
+	input.unget();
+	ASSERT_TRUE(input.good());
+
+	std::string token;
+	input >> token;
+	ASSERT_EQ(token, "bcd");
+}
+
+
+TEST(Helpers_PipeStreamTests, headerCanBePeekedWithoutConsumingIt)
+{
+	helpers::PipeStream input([](helpers::ChunkPipe& pipe) { pipe.push("EU4txt\ndate=1444.11.11"); });
+
+	ASSERT_EQ(input.peek(6), "EU4txt");
+
+	std::string token;
+	input >> token;
+	ASSERT_EQ(token, "EU4txt");
+}
+
+
+TEST(Helpers_PipeStreamTests, streamsCanBePumpedInSmallChunks)
+{
+	std::stringstream source;
+	source << "a=b\nc={ d e f }";
+
+	helpers::PipeStream input([&source](helpers::ChunkPipe& pipe) { helpers::pumpStream(source, pipe, 2); }, 2);
+
+	const std::string result{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+	ASSERT_EQ(result, "a=b\nc={ d e f }");
+}
+
+
+TEST(Helpers_PipeStreamTests, producerFailuresAreRethrown)
+{
+	helpers::PipeStream input([](helpers::ChunkPipe& pipe)
+		{
+			pipe.push("partial");
+			throw std::runtime_error("broken archive");
+		});
+
+	const std::string result{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+
+	ASSERT_EQ(result, "partial");
+	ASSERT_THROW(input.rethrowIfFailed(), std::runtime_error);
+}
+
+
+TEST(Helpers_PipeStreamTests, abandonedStreamDoesNotBlockProducer)
+{
+	{
+		helpers::PipeStream input([](helpers::ChunkPipe& pipe)
+			{
+				while (pipe.push("endless data ")) {}
+			}, 1);
+
+		std::string token;
+		input >> token;
+		ASSERT_EQ(token, "endless");
+	}
+	// Reaching this point means the destructor joined the producer.
+	SUCCEED();
+}
@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/RawBlocks.h"
+#include "../EU4toV2/Source/Helpers/ViewStream.h"
+#include <sstream>
+
+
+
+TEST(Helpers_RawBlocksTests, blockIsCapturedByBraceMatching)
+{
+	std::stringstream input;
+	input << "= { a = { b c } d = e } next";
+
+	const auto block = helpers::captureValue(input);
+
+	ASSERT_EQ(block.getText(), "{ a = { b c } d = e }");
+	std::string token;
+	input >> token;
+	ASSERT_EQ(token, "next");
+}
+
+
+TEST(Helpers_RawBlocksTests, bracesInQuotesAndCommentsAreIgnored)
+{
+	std::stringstream input;
+	input << "={ name=\"a } \\\" b\" # }\n}after";
+
+	const auto block = helpers::captureValue(input);
+
+	ASSERT_EQ(block.getText(), "{ name=\"a } \\\" b\" # }\n}");
+	std::string token;
+	input >> token;
+	ASSERT_EQ(token, "after");
+}
+
+
+TEST(Helpers_RawBlocksTests, singleTokensAndStringsCanBeCaptured)
+{
+	std::stringstream input;
+	input << "= 1444.11.11 = \"quoted value\" last";
+
+	ASSERT_EQ(helpers::captureValue(input).getText(), "1444.11.11");
+	ASSERT_EQ(helpers::captureValue(input).getText(), "\"quoted value\"");
+	ASSERT_EQ(helpers::captureValue(input).getText(), "last");
+}
+
+
+TEST(Helpers_RawBlocksTests, viewStreamBlocksReferToTheUnderlyingMemory)
+{
+	const std::string text = "= { 1 2 3 } rest";
+	helpers::ViewStream input(text);
+
+	const auto block = helpers::captureValue(input);
+
+	ASSERT_EQ(block.getText(), "{ 1 2 3 }");
+	ASSERT_EQ(block.getText().data(), text.data() + 2);
+	std::string token;
+	input >> token;
+	ASSERT_EQ(token, "rest");
+}
+
+
+TEST(Helpers_RawBlocksTests, unterminatedBlockRunsToEndOfStream)
+{
+	std::stringstream input;
+	input << "= { a = { b }";
+
+	ASSERT_EQ(helpers::captureValue(input).getText(), "{ a = { b }");
+}
+
+
+TEST(Helpers_RawBlocksTests, skippedValuesLeaveTheStreamAfterThem)
+{
+	std::stringstream input;
+	input << "= { a = \"}\" # }\n b = { c } } = token = rgb { 1 2 3 } = rgbish next";
+
+	helpers::skipValue(input);
+	std::string token;
+	input >> token;
+	ASSERT_EQ(token, "=");
+
+	helpers::skipValue(input);
+	helpers::skipValue(input);
+	helpers::skipValue(input);
+	input >> token;
+	ASSERT_EQ(token, "next");
+}
+
+
+TEST(Helpers_RawBlocksTests, viewStreamValuesAreSkippedInPlace)
+{
+	const std::string text = "={ ai = { 1 2 { 3 } } } rest";
+	helpers::ViewStream input(text);
+
+	helpers::ignoreItem("ai", input);
+
+	std::string token;
+	input >> token;
+	ASSERT_EQ(token, "rest");
+}
@@ -0,0 +1,40 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/Span.h"
+#include <vector>
+
+
+
+TEST(Helpers_SpanTests, defaultSpanIsEmpty)
+{
+	const helpers::Span<const int> span;
+
+	ASSERT_TRUE(span.empty());
+	ASSERT_EQ(span.size(), 0);
+	ASSERT_EQ(span.begin(), span.end());
+}
+
+
+TEST(Helpers_SpanTests, spanViewsContainerWithoutCopying)
+{
+	std::vector<int> numbers{1, 2, 3};
+	const helpers::Span<const int> span(numbers);
+
+	ASSERT_EQ(span.size(), 3);
+	ASSERT_EQ(span.data(), numbers.data());
+	ASSERT_EQ(span[1], 2);
+
+	numbers[1] = 5;
+	ASSERT_EQ(span[1], 5);
+}
+
+
+TEST(Helpers_SpanTests, spanCanBeIterated)
+{
+	const int numbers[] = {4, 5, 6, 7};
+	const helpers::Span<const int> span(numbers + 1, 2);
+
+	std::vector<int> seen;
+	for (const auto number: span) seen.push_back(number);
+
+	ASSERT_EQ(seen, std::vector<int>({5, 6}));
+}
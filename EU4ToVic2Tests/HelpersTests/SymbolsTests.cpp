@@ -0,0 +1,87 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/Symbols.h"
+#include "../EU4toV2/Source/Helpers/ThreadPool.h"
+#include <set>
+#include <string>
+#include <vector>
+
+
+
+TEST(Helpers_SymbolsTests, defaultSymbolIsEmptyString)
+{
+	const helpers::Symbol symbol;
+
+	ASSERT_TRUE(symbol.empty());
+	ASSERT_EQ(symbol.getString(), "");
+	ASSERT_EQ(symbol, helpers::Symbol(""));
+}
+
+
+TEST(Helpers_SymbolsTests, equalStringsGiveEqualSymbols)
+{
+	const helpers::Symbol first("TAG");
+	const helpers::Symbol second(std::string("TAG"));
+
+	ASSERT_FALSE(first.empty());
+	ASSERT_EQ(first, second);
+	ASSERT_EQ(first.getId(), second.getId());
+	ASSERT_EQ(first.getString(), "TAG");
+}
+
+
+TEST(Helpers_SymbolsTests, differentStringsGiveDifferentSymbols)
+{
+	const helpers::Symbol culture("swedish");
+	const helpers::Symbol religion("catholic");
+
+	ASSERT_NE(culture, religion);
+	ASSERT_EQ(culture.getString(), "swedish");
+	ASSERT_EQ(religion.getString(), "catholic");
+}
+
+
+TEST(Helpers_SymbolsTests, symbolsCanBeInternedFromManyThreads)
+{
+	helpers::ThreadPool pool(4);
+	std::vector<helpers::Symbol> symbols(1000);
+	pool.parallelFor(symbols.size(), [&symbols](const size_t index) {
+		symbols[index] = helpers::Symbol("thread_tag_" + std::to_string(index % 10));
+	});
+
+	for (size_t index = 0; index < symbols.size(); ++index)
+	{
+		ASSERT_EQ(symbols[index], symbols[index % 10]);
+		ASSERT_EQ(symbols[index].getString(), "thread_tag_" + std::to_string(index % 10));
+	}
+}
+
+
+TEST(Helpers_SymbolsTests, symbolsOrderByTheirStrings)
+{
+	// Interned in reverse, so an order by first sight would be reversed as well.
+	const helpers::Symbol last("order_c");
+	const helpers::Symbol middle("order_b");
+	const helpers::Symbol first("order_a");
+	const std::set<helpers::Symbol> symbols{last, first, middle};
+
+	ASSERT_EQ(std::vector<helpers::Symbol>(symbols.begin(), symbols.end()), std::vector<helpers::Symbol>({first, middle, last}));
+	ASSERT_FALSE(first < first);
+	ASSERT_TRUE(helpers::Symbol() < first);
+}
+
+
+TEST(Helpers_SymbolsTests, stringsCanBeReadWhileOthersAreInterned)
+{
+	helpers::ThreadPool pool(4);
+	const helpers::Symbol known("known_tag");
+	std::vector<std::string> strings(10000);
+	pool.parallelFor(strings.size(), [&known, &strings](const size_t index) {
+		if (index % 2) strings[index] = helpers::Symbol("growing_tag_" + std::to_string(index)).getString();
+		else strings[index] = known.getString();
+	});
+
+	for (size_t index = 0; index < strings.size(); ++index)
+	{
+		ASSERT_EQ(strings[index], index % 2 ? "growing_tag_" + std::to_string(index) : "known_tag");
+	}
+}
@@ -0,0 +1,70 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/ThreadPool.h"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+
+
+TEST(Helpers_ThreadPoolTests, submittedJobsReturnTheirResults)
+{
+	helpers::ThreadPool pool(2);
+
+	std::vector<std::future<int>> results;
+	for (auto i = 0; i < 20; ++i) results.emplace_back(pool.submit([i] { return i * i; }));
+
+	for (auto i = 0; i < 20; ++i) ASSERT_EQ(results[i].get(), i * i);
+}
+
+
+TEST(Helpers_ThreadPoolTests, exceptionsArriveThroughTheFuture)
+{
+	helpers::ThreadPool pool(1);
+
+	auto result = pool.submit([]() -> int { throw std::runtime_error("failed job"); });
+
+	ASSERT_THROW(result.get(), std::runtime_error);
+}
+
+
+TEST(Helpers_ThreadPoolTests, poolHasAtLeastOneThread)
+{
+	const helpers::ThreadPool pool(0);
+
+	ASSERT_EQ(pool.getThreadCount(), 1);
+}
+
+
+TEST(Helpers_ThreadPoolTests, parallelForVisitsEveryIndexOnce)
+{
+	helpers::ThreadPool pool(3);
+	std::vector<int> visits(1000, 0);
+
+	pool.parallelFor(visits.size(), [&visits](const size_t index) { ++visits[index]; });
+
+	for (const auto visit: visits) ASSERT_EQ(visit, 1);
+}
+
+
+TEST(Helpers_ThreadPoolTests, parallelForRethrowsFailures)
+{
+	helpers::ThreadPool pool(2);
+
+	ASSERT_THROW(pool.parallelFor(100, [](const size_t index) {
+		if (index == 42) throw std::runtime_error("failed item");
+	}), std::runtime_error);
+}
+
+
+TEST(Helpers_ThreadPoolTests, parallelForCanBeNestedInPoolJobs)
+{
+	helpers::ThreadPool pool(1);
+	std::atomic<size_t> sum{0};
+
+	auto outer = pool.submit([&pool, &sum] {
+		pool.parallelFor(100, [&sum](const size_t index) { sum += index; });
+	});
+	outer.get();
+
+	ASSERT_EQ(sum, 4950);
+}
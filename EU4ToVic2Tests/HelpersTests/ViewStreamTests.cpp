@@ -0,0 +1,58 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Helpers/ViewStream.h"
+#include <string>
+
+
+
+TEST(Helpers_ViewStreamTests, emptyViewIsImmediatelyExhausted)
+{
+	helpers::ViewStream input(std::string_view{});
+
+	std::string token;
+	input >> token;
+
+	ASSERT_TRUE(token.empty());
+	ASSERT_TRUE(input.eof());
+}
+
+
+TEST(Helpers_ViewStreamTests, viewCanBeRead)
+{
+	const std::string source = "key = value";
+	helpers::ViewStream input(source);
+
+	std::string key, equals, value;
+	input >> key >> equals >> value;
+
+	ASSERT_EQ(key, "key");
+	ASSERT_EQ(equals, "=");
+	ASSERT_EQ(value, "value");
+}
+
+
+TEST(Helpers_ViewStreamTests, viewIsNotCopied)
+{
+	std::string source = "before";
+	helpers::ViewStream input(source);
+	source[0] = 'B';
+
+	std::string token;
+	input >> token;
+
+	ASSERT_EQ(token, "Before");
+}
+
+
+TEST(Helpers_ViewStreamTests, viewCanBeRewound)
+{
+	const std::string source = "first second";
+	helpers::ViewStream input(source);
+
+	std::string token;
+	input >> token;
+	ASSERT_EQ(input.tellg(), 5);
+
+	input.seekg(0);
+	input >> token;
+	ASSERT_EQ(token, "first");
+}
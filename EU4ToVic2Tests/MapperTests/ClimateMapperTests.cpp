@@ -0,0 +1,42 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Mappers/Geography/ClimateMapper.h"
+#include <sstream>
+
+
+
+TEST(Mappers_ClimateMapperTests, provincesWithoutClimateHaveNone)
+{
+	std::stringstream input("mild_climate = { farm_rgo_size = 0.1 }\nmild_climate = { 1 2 }");
+	const mappers::ClimateMapper theClimateMapper(input);
+
+	ASSERT_FALSE(theClimateMapper.getClimateForProvince(3));
+	ASSERT_FALSE(theClimateMapper.getClimateForProvince(-1));
+}
+
+
+TEST(Mappers_ClimateMapperTests, provincesGetTheirClimate)
+{
+	std::stringstream input("mild_climate = { farm_rgo_size = 0.1 }\nharsh_climate = { farm_rgo_size = -0.1 }\nmild_climate = { 1 2 }\nharsh_climate = { 3 }");
+	const mappers::ClimateMapper theClimateMapper(input);
+
+	ASSERT_EQ(*theClimateMapper.getClimateForProvince(2), "mild_climate");
+	ASSERT_EQ(*theClimateMapper.getClimateForProvince(3), "harsh_climate");
+}
+
+
+TEST(Mappers_ClimateMapperTests, climateDefinitionsListNoProvinces)
+{
+	std::stringstream input("mild_climate = { 4 }");
+	const mappers::ClimateMapper theClimateMapper(input);
+
+	ASSERT_FALSE(theClimateMapper.getClimateForProvince(4));
+}
+
+
+TEST(Mappers_ClimateMapperTests, provinceInSeveralClimatesGetsTheFirstByName)
+{
+	std::stringstream input("temperate_climate = { }\nharsh_climate = { }\ntemperate_climate = { 5 }\nharsh_climate = { 5 }");
+	const mappers::ClimateMapper theClimateMapper(input);
+
+	ASSERT_EQ(*theClimateMapper.getClimateForProvince(5), "harsh_climate");
+}
@@ -103,6 +103,26 @@ TEST(Mappers_ProvinceMapperTests, properVesionIsUsed)
 }
 
 
+TEST(Mappers_ProvinceMapperTests, unusedVersionsAreNotParsed)
+{
+	std::stringstream input;
+	input << "1.0.0.0 = {\n";
+	input << "	link = { eu4 = 2 eu4 = 1 v2 = 3 v2 = 1 }\n";
+	input << "}";
+	input << "1.2.0.0 = {\n";
+	input << "	link = { eu4 = not_a_number v2 = \"{\" }\n";
+	input << "}";
+
+	Configuration testConfiguration;
+	EU4::Version testVersion("1.1.0.0");
+	testConfiguration.setEU4Version(testVersion);
+	mappers::ProvinceMapper theMapper(input, testConfiguration);
+
+	ASSERT_EQ(theMapper.getVic2ProvinceNumbers(1).size(), 2);
+	ASSERT_EQ(theMapper.getVic2ProvinceNumbers(1)[0], 3);
+}
+
+
 TEST(Mappers_ProvinceMapperTests, resettableProvicnesCanBeFound)
 {
 	std::stringstream input;
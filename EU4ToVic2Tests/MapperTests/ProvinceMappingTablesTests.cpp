@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/Mappers/ProvinceMappings/ProvinceMappingTables.h"
+#include "../EU4toV2/Source/Mappers/ProvinceMappings/ProvinceMappingsVersion.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+namespace fs = std::filesystem;
+
+
+
+namespace
+{
+	mappers::ProvinceMappingsVersion testMappings()
+	{
+		std::stringstream input;
+		input << "= {\n";
+		input << "	link = { eu4 = 2 eu4 = 1 v2 = 2 v2 = 1 resettable = testResettable }\n";
+		input << "	link = { eu4 = 3 v2 = 40 resettable = otherResettable }\n";
+		input << "	link = { eu4 = 3 v2 = 5 }\n";
+		input << "	link = { eu4 = 4 }\n";
+		input << "}";
+		return mappers::ProvinceMappingsVersion("1.0.0.0", input);
+	}
+
+	std::vector<int> toVector(const helpers::Span<const int> provinces)
+	{
+		return std::vector<int>(provinces.begin(), provinces.end());
+	}
+}
+
+
+TEST(Mappers_ProvinceMappingTablesTests, provincesCanBeLookedUpBothWays)
+{
+	const mappers::ProvinceMappingTables tables(testMappings());
+
+	ASSERT_EQ(toVector(tables.getVic2ProvinceNumbers(1)), std::vector<int>({2, 1}));
+	ASSERT_EQ(toVector(tables.getVic2ProvinceNumbers(3)), std::vector<int>({40}));
+	ASSERT_EQ(toVector(tables.getEU4ProvinceNumbers(40)), std::vector<int>({3}));
+	ASSERT_EQ(toVector(tables.getEU4ProvinceNumbers(5)), std::vector<int>({3}));
+}
+
+
+TEST(Mappers_ProvinceMappingTablesTests, unmappedProvincesHaveNoMappings)
+{
+	const mappers::ProvinceMappingTables tables(testMappings());
+
+	ASSERT_TRUE(tables.getVic2ProvinceNumbers(4).empty());
+	ASSERT_TRUE(tables.getVic2ProvinceNumbers(1000).empty());
+	ASSERT_TRUE(tables.getEU4ProvinceNumbers(3).empty());
+	ASSERT_TRUE(tables.getEU4ProvinceNumbers(-1).empty());
+}
+
+
+TEST(Mappers_ProvinceMappingTablesTests, resettableProvincesAreKeptPerRegion)
+{
+	const mappers::ProvinceMappingTables tables(testMappings());
+
+	ASSERT_TRUE(tables.isProvinceResettable(1, "testResettable"));
+	ASSERT_TRUE(tables.isProvinceResettable(40, "otherResettable"));
+	ASSERT_FALSE(tables.isProvinceResettable(40, "testResettable"));
+	ASSERT_FALSE(tables.isProvinceResettable(5, "otherResettable"));
+	ASSERT_FALSE(tables.isProvinceResettable(1, "missingResettable"));
+}
+
+
+TEST(Mappers_ProvinceMappingTablesTests, savedTablesCanBeLoaded)
+{
+	fs::remove_all("ProvinceMappingTablesTests");
+	mappers::ProvinceMappingTables(testMappings()).save("ProvinceMappingTablesTests/mappings.tables");
+
+	const auto tables = mappers::ProvinceMappingTables::load("ProvinceMappingTablesTests/mappings.tables");
+
+	ASSERT_NE(tables, nullptr);
+	ASSERT_EQ(toVector(tables->getVic2ProvinceNumbers(2)), std::vector<int>({2, 1}));
+	ASSERT_EQ(toVector(tables->getEU4ProvinceNumbers(2)), std::vector<int>({2, 1}));
+	ASSERT_TRUE(tables->isProvinceResettable(2, "testResettable"));
+	ASSERT_TRUE(tables->isProvinceResettable(40, "otherResettable"));
+	fs::remove_all("ProvinceMappingTablesTests");
+}
+
+
+TEST(Mappers_ProvinceMappingTablesTests, damagedTablesAreNotLoaded)
+{
+	fs::remove_all("ProvinceMappingTablesTestsDamaged");
+	mappers::ProvinceMappingTables(testMappings()).save("ProvinceMappingTablesTestsDamaged/mappings.tables");
+	fs::resize_file("ProvinceMappingTablesTestsDamaged/mappings.tables", fs::file_size("ProvinceMappingTablesTestsDamaged/mappings.tables") - 4);
+
+	ASSERT_EQ(mappers::ProvinceMappingTables::load("ProvinceMappingTablesTestsDamaged/mappings.tables"), nullptr);
+	ASSERT_EQ(mappers::ProvinceMappingTables::load("ProvinceMappingTablesTestsDamaged/missing.tables"), nullptr);
+	fs::remove_all("ProvinceMappingTablesTestsDamaged");
+}
+
+
+TEST(Mappers_ProvinceMappingTablesTests, savingLeavesOtherTemporaryFilesAlone)
+{
+	fs::remove_all("ProvinceMappingTablesTestsShared");
+	fs::create_directories("ProvinceMappingTablesTestsShared");
+	// As left by another converter writing the same tables.
+	std::ofstream("ProvinceMappingTablesTestsShared/mappings.tables.tmp") << "half";
+	mappers::ProvinceMappingTables(testMappings()).save("ProvinceMappingTablesTestsShared/mappings.tables");
+
+	ASSERT_NE(mappers::ProvinceMappingTables::load("ProvinceMappingTablesTestsShared/mappings.tables"), nullptr);
+	ASSERT_EQ(fs::file_size("ProvinceMappingTablesTestsShared/mappings.tables.tmp"), 4);
+	ASSERT_EQ(std::distance(fs::directory_iterator("ProvinceMappingTablesTestsShared"), fs::directory_iterator()), 2);
+	fs::remove_all("ProvinceMappingTablesTestsShared");
+}
@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+#include "../EU4toV2/Source/EU4World/Localisation/EU4Localisation.h"
+#include "../EU4toV2/Source/Mappers/RegionLocalizations/RegionLocalizations.h"
+#include <filesystem>
+#include <fstream>
+namespace fs = std::filesystem;
+
+
+
+namespace
+{
+	void writeFile(const std::string& path, const std::string& content)
+	{
+		fs::create_directories(fs::path(path).parent_path());
+		std::ofstream(path, std::ios::binary) << content;
+	}
+}
+
+
+TEST(Mappers_RegionLocalizationsTests, namesComeInEachLanguage)
+{
+	writeFile("RegionLocalizationsTestsLanguages/areas_l_english.yml", "l_english:\n scania_area:0 \"Scania\"\n");
+	writeFile("RegionLocalizationsTestsLanguages/areas_l_french.yml", "l_french:\n scania_area:0 \"Scanie\"\n");
+	writeFile("RegionLocalizationsTestsLanguages/areas_l_german.yml", "l_german:\n scania_area:0 \"Schonen\"\n");
+	writeFile("RegionLocalizationsTestsLanguages/areas_l_spanish.yml", "l_spanish:\n scania_area:0 \"Escania\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromAllFilesInFolder("RegionLocalizationsTestsLanguages");
+	const mappers::RegionLocalizations regionLocalizations(localisation);
+
+	ASSERT_EQ(*regionLocalizations.getEnglishFor("scania_area"), "Scania");
+	ASSERT_EQ(*regionLocalizations.getFrenchFor("scania_area"), "Scanie");
+	ASSERT_EQ(*regionLocalizations.getGermanFor("scania_area"), "Schonen");
+	ASSERT_EQ(*regionLocalizations.getSpanishFor("scania_area"), "Escania");
+	fs::remove_all("RegionLocalizationsTestsLanguages");
+}
+
+
+TEST(Mappers_RegionLocalizationsTests, missingNamesAreNotFound)
+{
+	writeFile("RegionLocalizationsTestsMissing/areas_l_english.yml", "l_english:\n scania_area:0 \"Scania\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromAllFilesInFolder("RegionLocalizationsTestsMissing");
+	const mappers::RegionLocalizations regionLocalizations(localisation);
+
+	ASSERT_FALSE(regionLocalizations.getEnglishFor("svealand_area"));
+	ASSERT_FALSE(regionLocalizations.getFrenchFor("scania_area"));
+	fs::remove_all("RegionLocalizationsTestsMissing");
+}
+
+
+TEST(Mappers_RegionLocalizationsTests, laterFilesOverrideEarlierNames)
+{
+	writeFile("RegionLocalizationsTestsOverride/game/areas_l_english.yml", "l_english:\n scania_area:0 \"Scania\"\n");
+	writeFile("RegionLocalizationsTestsOverride/mod/areas_l_english.yml", "l_english:\n scania_area:0 \"Skåneland\"\n");
+	EU4::EU4Localisation localisation;
+	localisation.readFromAllFilesInFolder("RegionLocalizationsTestsOverride/game");
+	localisation.readFromAllFilesInFolder("RegionLocalizationsTestsOverride/mod");
+	const mappers::RegionLocalizations regionLocalizations(localisation);
+
+	ASSERT_EQ(*regionLocalizations.getEnglishFor("scania_area"), "Skåneland");
+	fs::remove_all("RegionLocalizationsTestsOverride");
+}
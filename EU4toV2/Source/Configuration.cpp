@@ -2,6 +2,7 @@
 #include "ParserHelpers.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include "Helpers/ContentHash.h"
 #include <vector>
 
 Configuration theConfiguration;
@@ -17,6 +18,7 @@ void Configuration::instantiate(std::istream& theStream, bool (*doesFolderExist)
 		const commonItems::singleString path(theStream);
 		EU4Path = path.getString();
 		verifyEU4Path(EU4Path, doesFolderExist, doesFileExist);
+		resetEU4Files();
 	});
 	registerKeyword("EU4DocumentsDirectory", [this](const std::string& unused, std::istream& theStream){
 		const commonItems::singleString path(theStream);
@@ -34,6 +36,7 @@ void Configuration::instantiate(std::istream& theStream, bool (*doesFolderExist)
 		const commonItems::singleString path(theStream);
 		Vic2Path = path.getString();
 		verifyVic2Path(Vic2Path, doesFolderExist, doesFileExist);
+		Vic2Definitions = std::make_shared<helpers::FilePack>("cache/vic2_" + helpers::ContentHash().update(Vic2Path).toString() + ".pack");
 	});
 	registerKeyword("Vic2Documentsdirectory", [this, doesFolderExist](const std::string& unused, std::istream& theStream){
 		const commonItems::singleString path(theStream);
@@ -89,6 +92,11 @@ void Configuration::instantiate(std::istream& theStream, bool (*doesFolderExist)
 		const commonItems::singleString debugString(theStream);
 		debug = (debugString.getString() == "yes");
 	});
+	registerKeyword("save_snapshots", [this](const std::string& unused, std::istream& theStream) {
+		const commonItems::singleString saveSnapshotsString(theStream);
+		saveSnapshots = saveSnapshotsString.getString() == "yes";
+		LOG(LogLevel::Info) << "Save Snapshots: " << saveSnapshotsString.getString();
+	});
 	registerKeyword("randomise_rgos", [this](const std::string& unused, std::istream& theStream){
 		const commonItems::singleString randomiseRgosString(theStream);
 		randomiseRgos = randomiseRgosString.getString() == "yes";
@@ -137,6 +145,25 @@ void Configuration::verifyVic2DocumentsPath(const std::string& path, bool (*does
 }
 
 
+void Configuration::addEU4Mod(const std::string& mod)
+{
+	EU4Mods.push_back(mod);
+	resetEU4Files();
+}
+
+void Configuration::resetEU4Files()
+{
+	std::vector<std::string> roots{EU4Path};
+	roots.insert(roots.end(), EU4Mods.begin(), EU4Mods.end());
+	// Each install and mod list gets a pack of its own, so switching between saves doesn't
+	// throw away the pack of the other.
+	helpers::ContentHash rootsHash;
+	for (const auto& root: roots) rootsHash.update(root).update("\n");
+	EU4Definitions = std::make_shared<helpers::FilePack>("cache/eu4_" + rootsHash.toString() + ".pack");
+
+	EU4Files = std::make_shared<helpers::FileOverlay>(std::move(roots));
+}
+
 bool Configuration::wasDLCActive(const std::string& DLC) const
 {
 	for (const auto& activeDLC: activeDLCs) if (DLC == activeDLC) return true;
@@ -2,8 +2,11 @@
 #define CONFIGURATION_H
 
 #include "EU4World/EU4Version.h"
+#include "Helpers/FileOverlay.h"
+#include "Helpers/FilePack.h"
 #include "Date.h"
 #include "newParser.h"
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -27,7 +30,7 @@ class Configuration: commonItems::parser
 		void setStartEU4Date(date _startDate) { startEU4Date = _startDate; }
 		void setOutputName(const std::string& name) { outputName = name; }
 		void setActualName(const std::string& name) { actualName = name; }
-		void addEU4Mod(const std::string& mod) { EU4Mods.push_back(mod); }
+		void addEU4Mod(const std::string& mod);
 		void setEU4Version(const EU4::Version& _version) { version = _version; }
 		void setEU4RandomSeed(int seed) { eu4Seed = seed; }
 		void setActiveDLCs(const std::vector<std::string>& _activeDLCs) { activeDLCs = _activeDLCs; }
@@ -50,6 +53,7 @@ class Configuration: commonItems::parser
 		[[nodiscard]] auto getPopShapingFactor() const { return popShapingFactor; }
 		[[nodiscard]] auto getAbsorbColonies() const { return absorbColonies; }
 		[[nodiscard]] auto getDebug() const { return debug; }
+		[[nodiscard]] auto getSaveSnapshots() const { return saveSnapshots; }
 		[[nodiscard]] auto getRandomiseRgos() const { return randomiseRgos; }
 		[[nodiscard]] auto getConvertAll() const { return convertAll; }
 		[[nodiscard]] auto getAfricaReset() const { return africaReset; }
@@ -69,6 +73,12 @@ class Configuration: commonItems::parser
 		[[nodiscard]] const auto& getOutputName() const { return outputName; }
 		[[nodiscard]] const auto& getActualName() const { return actualName; }
 		[[nodiscard]] const auto& getEU4Mods() const { return EU4Mods; }
+		// The install with the enabled mods laid over it. Loaders should look their files up here.
+		[[nodiscard]] const auto& getEU4Files() const { return *EU4Files; }
+		// Contents of the EU4 definition files, kept between runs for this install and mod list.
+		[[nodiscard]] auto& getEU4Definitions() const { return *EU4Definitions; }
+		// The same for the Vic2 base data and the blankMod files overriding it.
+		[[nodiscard]] auto& getVic2Definitions() const { return *Vic2Definitions; }
 
 		[[nodiscard]] bool wasDLCActive(const std::string& DLC) const;
 
@@ -77,6 +87,7 @@ class Configuration: commonItems::parser
 		static void verifyVic2Path(const std::string& path, bool (*doesFolderExist)(const std::string& path2), bool (*doesFileExist)(const std::string& path3));
 		static void verifyVic2DocumentsPath(const std::string& path, bool (*doesFolderExist)(const std::string& path2));
 		void setOutputName();
+		void resetEU4Files();
 		static std::string trimPath(const std::string& fileName);
 		static std::string trimExtension(const std::string& fileName);
 		static std::string replaceCharacter(std::string fileName, char character);
@@ -100,6 +111,7 @@ class Configuration: commonItems::parser
 		AFRICARESET africaReset = AFRICARESET::ResetAfrica;
 		double popShapingFactor = 50.0;
 		bool debug = false;
+		bool saveSnapshots = false;
 		bool randomiseRgos = false;
 		bool convertAll = false;
 	
@@ -114,6 +126,9 @@ class Configuration: commonItems::parser
 		std::string actualName; // Not normalized like outputName
 		std::vector<std::string> activeDLCs;
 		std::vector<std::string> EU4Mods;
+		std::shared_ptr<helpers::FileOverlay> EU4Files = std::make_shared<helpers::FileOverlay>();
+		std::shared_ptr<helpers::FilePack> EU4Definitions = std::make_shared<helpers::FilePack>("cache/eu4_definitions.pack");
+		std::shared_ptr<helpers::FilePack> Vic2Definitions = std::make_shared<helpers::FilePack>("cache/vic2_definitions.pack");
 };
 
 extern Configuration theConfiguration;
@@ -1,27 +1,31 @@
 #include "EU4Army.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
-EU4::EU4Army::EU4Army(std::istream& theStream, const std::string& potentialNavy)
+void EU4::EU4Army::registerKeywords(helpers::KeywordTable<EU4Army>& keywords)
 {
-	registerKeyword("name", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("name", [](EU4Army& army, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString nameStr(theStream);
-			name = nameStr.getString();
+			army.name = nameStr.getString();
 		});
-	registerRegex("regiment|ship", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerRegex("regiment|ship", [](EU4Army& army, const std::string& unused, std::istream& theStream)
 		{
 			const EU4Regiment regimentBlock(theStream);
-			regimentList.push_back(regimentBlock);
+			army.regimentList.push_back(regimentBlock);
 		});
-	registerKeyword("location", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("location", [](EU4Army& army, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleInt locationInt(theStream);
-			location = locationInt.getInt();
+			army.location = locationInt.getInt();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	keywords.registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
+}
 
-	parseStream(theStream);
-	clearRegisteredKeywords();
+EU4::EU4Army::EU4Army(std::istream& theStream, const std::string& potentialNavy)
+{
+	thread_local helpers::KeywordTable<EU4Army> keywords(registerKeywords);
+	keywords.parse(*this, theStream);
 
 	if (potentialNavy == "navy") armyFloats = true;
 }
@@ -4,10 +4,11 @@
 #include <vector>
 #include "EU4Regiment.h"
 #include "../../Mappers/UnitTypes/UnitTypeMapper.h"
+#include "../../Helpers/KeywordTable.h"
 
 namespace EU4
 {
-	class EU4Army : public commonItems::parser
+	class EU4Army
 	{
 	public:
 		EU4Army() = default;
@@ -23,6 +24,8 @@ namespace EU4
 		void resolveRegimentTypes(const mappers::UnitTypeMapper& unitTypeMapper);
 
 	private:
+		static void registerKeywords(helpers::KeywordTable<EU4Army>& keywords);
+
 		std::string name;
 		int location = 0;
 		bool armyFloats = false;
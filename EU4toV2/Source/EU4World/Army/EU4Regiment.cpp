@@ -1,25 +1,29 @@
 #include "EU4Regiment.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
-EU4::EU4Regiment::EU4Regiment(std::istream& theStream)
+void EU4::EU4Regiment::registerKeywords(helpers::KeywordTable<EU4Regiment>& keywords)
 {
-	registerKeyword("name", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("name", [](EU4Regiment& regiment, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString nameStr(theStream);
-			name = nameStr.getString();
+			regiment.name = nameStr.getString();
 		});
-	registerKeyword("type", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("type", [](EU4Regiment& regiment, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString typeStr(theStream);
-			regimentType = typeStr.getString();
+			regiment.regimentType = typeStr.getString();
 		});
-	registerKeyword("home", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("home", [](EU4Regiment& regiment, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleInt homeInt(theStream);
-			home = homeInt.getInt();
+			regiment.home = homeInt.getInt();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	keywords.registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
+}
 
-	parseStream(theStream);
-	clearRegisteredKeywords();
+EU4::EU4Regiment::EU4Regiment(std::istream& theStream)
+{
+	thread_local helpers::KeywordTable<EU4Regiment> keywords(registerKeywords);
+	keywords.parse(*this, theStream);
 }
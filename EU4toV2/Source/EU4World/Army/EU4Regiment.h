@@ -3,6 +3,7 @@
 
 #include <map>
 #include "../ID.h"
+#include "../../Helpers/KeywordTable.h"
 
 namespace EU4
 {
@@ -44,7 +45,7 @@ namespace EU4
 		{ REGIMENTCATEGORY::num_reg_categories, "unassigned category!" }
 	};
 
-	class EU4Regiment : public  commonItems::parser
+	class EU4Regiment
 	{
 	public:
 		EU4Regiment() = default;
@@ -59,6 +60,8 @@ namespace EU4
 		void setTypeStrength(const int tStrength) { typeStrength = tStrength; }
 
 	private:
+		static void registerKeywords(helpers::KeywordTable<EU4Regiment>& keywords);
+
 		std::string name;
 		std::string regimentType;
 		int home = 0;
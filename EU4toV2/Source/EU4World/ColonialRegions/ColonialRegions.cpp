@@ -2,7 +2,6 @@
 #include "ColonialRegions.h"
 #include "../../Configuration.h"
 #include "Log.h"
-#include "OSCompatibilityLayer.h"
 #include "ParserHelpers.h"
 
 EU4::ColonialRegions::ColonialRegions()
@@ -19,26 +18,14 @@ EU4::ColonialRegions::ColonialRegions()
 		});
 	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
 
-	if (!Utils::DoesFileExist(theConfiguration.getEU4Path() + "/common/colonial_regions/00_colonial_regions.txt"))
+	const auto filenames = theConfiguration.getEU4Files().list("common/colonial_regions");
+	if (filenames.empty())
 	{
-		Log(LogLevel::Warning) << "Could not find " << theConfiguration.getEU4Path() + "/common/colonial_regions/00_colonial_regions.txt";
+		Log(LogLevel::Warning) << "Could not find any common/colonial_regions files in " << theConfiguration.getEU4Path() << " or the mods";
 	}
-	else
+	for (const auto& filename : filenames)
 	{
-		parseFile(theConfiguration.getEU4Path() + "/common/colonial_regions/00_colonial_regions.txt");
-	}
-
-	for (const auto& mod: theConfiguration.getEU4Mods())
-	{
-		std::set<std::string> filenames;
-		if (Utils::doesFolderExist(mod + "/common/colonial_regions/"))
-		{
-			Utils::GetAllFilesInFolder(mod + "/common/colonial_regions/", filenames);
-			for (const auto& filename : filenames)
-			{
-				parseFile(mod + "/common/colonial_regions/" + filename);
-			}
-		}
+		parseStream(*theConfiguration.getEU4Definitions().open(filename));
 	}
 	clearRegisteredKeywords();
 }
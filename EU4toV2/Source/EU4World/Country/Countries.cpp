@@ -1,5 +1,9 @@
 #include "Countries.h"
+#include "Log.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
+#include "../../Helpers/ThreadPool.h"
+#include "../../Helpers/ViewStream.h"
 
 EU4::Countries::Countries(
 	const Version& theVersion,
@@ -7,18 +11,38 @@ EU4::Countries::Countries(
 	const mappers::IdeaEffectMapper& ideaEffectMapper, 
 	const mappers::CultureGroups& cultureGroupsMapper)
 {
-	registerKeyword("---", commonItems::ignoreItem);
-	registerKeyword("REB", commonItems::ignoreItem);
-	registerKeyword("PIR", commonItems::ignoreItem);
-	registerKeyword("NAT", commonItems::ignoreItem);
-	registerRegex("[A-Z0-9]{3}", [this, theVersion, ideaEffectMapper, cultureGroupsMapper](const std::string& tag, std::istream& theStream)
+	registerKeyword("---", helpers::ignoreItem);
+	registerKeyword("REB", helpers::ignoreItem);
+	registerKeyword("PIR", helpers::ignoreItem);
+	registerKeyword("NAT", helpers::ignoreItem);
+	// Country blocks don't depend on each other, so they are only cut out here and built in parallel below.
+	std::vector<std::pair<std::string, helpers::RawBlock>> countryBlocks;
+	registerRegex("[A-Z0-9]{3}", [&countryBlocks](const std::string& tag, std::istream& theStream)
 		{
-			auto country = std::make_shared<Country>(tag, theVersion, theStream, ideaEffectMapper, cultureGroupsMapper);
-			theCountries.insert(std::make_pair(tag, country));
+			countryBlocks.emplace_back(tag, helpers::captureValue(theStream));
 		}
 	);
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
+
+	std::vector<std::shared_ptr<Country>> builtCountries(countryBlocks.size());
+	helpers::ThreadPool::shared().parallelFor(countryBlocks.size(), [&](const size_t index)
+		{
+			helpers::ViewStream blockStream(countryBlocks[index].second.getText());
+			builtCountries[index] = std::make_shared<Country>(countryBlocks[index].first, theVersion, blockStream, ideaEffectMapper, cultureGroupsMapper);
+		}
+	);
+	// Countries are built on worker threads, which must not log, so their complaints are logged here.
+	// Map colors are adjusted here as well, so the random draws come in save order on every run.
+	for (size_t index = 0; index < countryBlocks.size(); ++index)
+	{
+		builtCountries[index]->fluctuateMapColor();
+		if (const auto& attitude = builtCountries[index]->getUnknownAttitude(); !attitude.empty())
+		{
+			LOG(LogLevel::Warning) << "Unknown attitude type " << attitude << " while setting liberty desire for " << countryBlocks[index].first;
+		}
+		theCountries.insert(std::make_pair(countryBlocks[index].first, std::move(builtCountries[index])));
+	}
 }
\ No newline at end of file
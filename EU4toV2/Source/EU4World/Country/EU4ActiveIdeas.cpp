@@ -1,5 +1,6 @@
 #include "EU4ActiveIdeas.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::EU4ActiveIdeas::EU4ActiveIdeas(std::istream& theStream)
 {
@@ -10,7 +11,7 @@ EU4::EU4ActiveIdeas::EU4ActiveIdeas(std::istream& theStream)
 			if (ideaInt.getInt() >= 7) activeIdeas.insert(ideaName);
 		}
 	);
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
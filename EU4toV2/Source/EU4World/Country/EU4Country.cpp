@@ -3,6 +3,7 @@
 #include "../../Configuration.h"
 #include "Log.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 #include "../Relations/EU4Relations.h"
 #include "../History/CountryHistory.h"
 #include "../../V2World/Localisation/Localisation.h"
@@ -13,245 +14,250 @@
 #include <cmath>
 #include "OSCompatibilityLayer.h"
 
-EU4::Country::Country(
-	std::string countryTag,
-	const Version& theVersion, 
-	std::istream& theStream, 
-	const mappers::IdeaEffectMapper& ideaEffectMapper, 
-	const mappers::CultureGroups& cultureGroupsMapper
-): tag(std::move(countryTag))
+void EU4::Country::registerKeywords(helpers::KeywordTable<Country, Version>& keywords)
 {
-	registerKeyword("name", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("name", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString theName(theStream);
-			name = theName.getString();
-			name = Utils::normalizeUTF8Path(name);
+			country.name = theName.getString();
+			country.name = Utils::normalizeUTF8Path(country.name);
 		});
-	registerKeyword("custom_name", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("custom_name", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString theName(theStream);
-			randomName = V2::Localisation::convert(theName.getString());
-			customNation = true;
+			country.randomName = V2::Localisation::convert(theName.getString());
+			country.customNation = true;
 		});
-	registerKeyword("adjective", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("adjective", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString theAdjective(theStream);
-			adjective = theAdjective.getString();
+			country.adjective = theAdjective.getString();
 		});
 	// This is obsolete and not applicable from at least 1.19+, probably further back
-	registerKeyword("map_color", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("map_color", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
-			auto colorColor = commonItems::Color(theStream);
-			colorColor.RandomlyFlunctuate(30);
+			const auto colorColor = commonItems::Color(theStream);
 			// Countries whose colors are included in the object here tend to be generated countries,
 			// i.e. colonial nations which take on the color of their parent. To help distinguish 
-			// these countries from their parent's other colonies we randomly adjust the color.
-			nationalColors.setMapColor(colorColor);
+			// these countries from their parent's other colonies we randomly adjust the color,
+			// once all countries are built so the random draws follow save order.
+			country.nationalColors.setMapColor(colorColor);
+			country.mapColorToFluctuate = true;
 		});
-	registerKeyword("colors", [this](const std::string& colorsString, std::istream& theStream)
+	keywords.registerKeyword("colors", [](Country& country, const Version& theVersion, const std::string& colorsString, std::istream& theStream)
 		{
 			const NationalSymbol theSection(theStream);
-			nationalColors = theSection;
+			country.nationalColors = theSection;
+			country.mapColorToFluctuate = false;
 		});
-	registerKeyword("capital", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("capital", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleInt theCapital(theStream);
-			capital = theCapital.getInt();
+			country.capital = theCapital.getInt();
 		});
-	registerKeyword("technology_group", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("technology_group", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString theTechGroup(theStream);
-			techGroup = theTechGroup.getString();
+			country.techGroup = theTechGroup.getString();
 		});
-	registerKeyword("liberty_desire", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("liberty_desire", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleDouble theLibertyDesire(theStream);
-			libertyDesire = theLibertyDesire.getDouble();
+			country.libertyDesire = theLibertyDesire.getDouble();
 		});
-	registerKeyword("institutions", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("institutions", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::intList theInstitutions(theStream);
 			for (auto institution: theInstitutions.getInts())
 			{
 				if (institution == 1)
 				{
-					embracedInstitutions.push_back(true);
+					country.embracedInstitutions.push_back(true);
 				}
 				else
 				{
-					embracedInstitutions.push_back(false);
+					country.embracedInstitutions.push_back(false);
 				}
 			}
 		});
-	registerKeyword("isolationism", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("isolationism", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleInt isolationismValue(theStream);
-			isolationism = isolationismValue.getInt();
+			country.isolationism = isolationismValue.getInt();
 		});
-	registerKeyword("primary_culture", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("primary_culture", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString thePrimaryCulture(theStream);
-			primaryCulture = thePrimaryCulture.getString();
+			country.primaryCulture = helpers::Symbol(thePrimaryCulture.getString());
 		});
-	registerKeyword("accepted_culture", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("accepted_culture", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			// accepted cultures are not used at the moment.
 			const commonItems::singleString theAcceptedCulture(theStream);
-			acceptedCultures.insert(theAcceptedCulture.getString());
+			country.acceptedCultures.insert(theAcceptedCulture.getString());
 		});
-	registerKeyword("government_rank", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("government_rank", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleInt theGovernmentRank(theStream);
-			governmentRank = theGovernmentRank.getInt();
+			country.governmentRank = theGovernmentRank.getInt();
 		});
-	registerKeyword("realm_development", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("realm_development", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleInt theDevelopment(theStream);
-			development = theDevelopment.getInt();
+			country.development = theDevelopment.getInt();
 		});
 	// obsolete since 1.18 at the latest
-	registerKeyword("culture_group_union", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("culture_group_union", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
-			commonItems::ignoreItem(unused, theStream);
-			culturalUnion = true;
+			helpers::ignoreItem(unused, theStream);
+			country.culturalUnion = true;
 		});
-	registerKeyword("religion", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("religion", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString theReligion(theStream);
-			religion = theReligion.getString();
+			country.religion = helpers::Symbol(theReligion.getString());
 		});
 	// Obsolete since 1.26.0
-	registerKeyword("score", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("score", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleDouble theScore(theStream);
-			score = theScore.getDouble();
+			country.score = theScore.getDouble();
 		});
 	//Relevant since 1.20 but we only use it for 1.26+
-	registerKeyword("age_score", [this, theVersion](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("age_score", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream) 
 		{
 			if (theVersion >= Version("1.26.0.0"))
 			{
 				const commonItems::doubleList ageScores(theStream);
-				for (auto& agScore : ageScores.getDoubles()) score += agScore;
+				for (auto& agScore : ageScores.getDoubles()) country.score += agScore;
 			}
 		});
-	registerKeyword("stability", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("stability", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleDouble theStability(theStream);
-			stability = theStability.getDouble();
+			country.stability = theStability.getDouble();
 		});
-	registerKeyword("technology", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("technology", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const EU4Technology techBlock(theStream);
-			admTech = techBlock.getAdm();
-			dipTech = techBlock.getDip();
-			milTech = techBlock.getMil();
+			country.admTech = techBlock.getAdm();
+			country.dipTech = techBlock.getDip();
+			country.milTech = techBlock.getMil();
 		});
-	registerRegex("flags|hidden_flags|variables", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerRegex("flags|hidden_flags|variables", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const EU4CountryFlags flagsBlock(theStream);
-			for (const auto& flag : flagsBlock.getFlags()) flags.insert(flag);
+			for (const auto& flag : flagsBlock.getFlags()) country.flags.insert(flag);
 		});
-	registerKeyword("modifier", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("modifier", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const EU4Modifier newModifier(theStream);
 			if (!newModifier.getModifier().empty())
 			{
-				modifiers[newModifier.getModifier()] = true;
+				country.modifiers[newModifier.getModifier()] = true;
 			}
 		});
-	registerKeyword("government", [this, theVersion](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("government", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			if (theVersion < Version("1.23.0.0"))
 			{
 				const commonItems::singleString govStr(theStream);
-				government = govStr.getString();
+				country.government = govStr.getString();
 			}
 			else
 			{
 				const GovernmentSection theSection(theStream);
-				government = theSection.getGovernment();
-				governmentReforms = theSection.getGovernmentReforms();
+				country.government = theSection.getGovernment();
+				country.governmentReforms = theSection.getGovernmentReforms();
 			}
 		});
-	registerKeyword("active_relations", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("active_relations", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const EU4Relations activeRelations(theStream);
-			relations = activeRelations.getRelations();
+			country.relations = activeRelations.getRelations();
 		});
-	registerRegex("army|navy", [this](const std::string& armyFloats, std::istream& theStream)
+	keywords.registerRegex("army|navy", [](Country& country, const Version& theVersion, const std::string& armyFloats, std::istream& theStream)
 		{
 			const EU4Army army(theStream, armyFloats);
-			armies.push_back(army);
+			country.armies.push_back(army);
 		});
-	registerKeyword("active_idea_groups", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("active_idea_groups", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const EU4ActiveIdeas activeIdeas(theStream);
-			nationalIdeas = activeIdeas.getActiveIdeas();
+			country.nationalIdeas = activeIdeas.getActiveIdeas();
 		});
-	registerRegex("legitimacy|horde_unity|devotion|meritocracy|republican_tradition", [this](const std::string& legitimacyType, std::istream& theStream)
+	keywords.registerRegex("legitimacy|horde_unity|devotion|meritocracy|republican_tradition", [](Country& country, const Version& theVersion, const std::string& legitimacyType, std::istream& theStream)
 		{
 			const commonItems::singleDouble theLegitimacy(theStream);
-			if (legitimacyType == "legitimacy" || legitimacyType == "meritocracy") legitimacy = theLegitimacy.getDouble();
-			if (legitimacyType == "horde_unity") hordeUnity = theLegitimacy.getDouble();
-			if (legitimacyType == "devotion") devotion = theLegitimacy.getDouble();
-			if (legitimacyType == "republican_tradition") republicanTradition = theLegitimacy.getDouble();
+			if (legitimacyType == "legitimacy" || legitimacyType == "meritocracy") country.legitimacy = theLegitimacy.getDouble();
+			if (legitimacyType == "horde_unity") country.hordeUnity = theLegitimacy.getDouble();
+			if (legitimacyType == "devotion") country.devotion = theLegitimacy.getDouble();
+			if (legitimacyType == "republican_tradition") country.republicanTradition = theLegitimacy.getDouble();
 		});
-	registerKeyword("average_autonomy", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("average_autonomy", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleDouble autonomyDbl(theStream);
-			averageAutonomy = autonomyDbl.getDouble();
+			country.averageAutonomy = autonomyDbl.getDouble();
 		});
-	registerKeyword("parent", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("parent", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString alsoUnused(theStream);
-			colony = true;
+			country.colony = true;
 		});
-	registerKeyword("colonial_parent", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("colonial_parent", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString alsoUnused(theStream);
-			colony = true;
+			country.colony = true;
 		});
-	registerKeyword("overlord", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("overlord", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString theOverlord(theStream);
-			overlord = theOverlord.getString();
+			country.overlord = theOverlord.getString();
 		});
 	// This is obsolete and not applicable from at least 1.19+, probably further back:
 	// In current save game implementation, custom_colors stores a color triplet, but apparently it used to
 	// store a custom colors block with flag and symbol - which is now in colors block.
-	registerKeyword("country_colors", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("country_colors", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const CustomColors colorBlock(theStream);
-			nationalColors.setCustomColors(colorBlock);
-			nationalColors.setCustomColorsInitialized();
+			country.nationalColors.setCustomColors(colorBlock);
+			country.nationalColors.setCustomColorsInitialized();
 		});
 	// This is obsolete and not applicable from at least 1.19+, probably further back
-	registerKeyword("revolutionary_colors", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("revolutionary_colors", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const auto colorColor = commonItems::Color(theStream);
-			nationalColors.setRevolutionaryColor(colorColor);
+			country.nationalColors.setRevolutionaryColor(colorColor);
 		});
-	registerKeyword("history", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("history", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const CountryHistory theCountryHistory(theStream);
-			historicalLeaders = theCountryHistory.getLeaders();
-			if (!theCountryHistory.getDynasty().empty()) historicalEntry.lastDynasty = theCountryHistory.getDynasty();
-			historicalPrimaryCulture = theCountryHistory.getPrimaryCulture();
-			historicalReligion = theCountryHistory.getReligion();
+			country.historicalLeaders = theCountryHistory.getLeaders();
+			if (!theCountryHistory.getDynasty().empty()) country.historicalEntry.lastDynasty = theCountryHistory.getDynasty();
+			country.historicalPrimaryCulture = theCountryHistory.getPrimaryCulture();
+			country.historicalReligion = theCountryHistory.getReligion();
 		});
-	registerKeyword("leader", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("leader", [](Country& country, const Version& theVersion, const std::string& unused, std::istream& theStream)
 		{
 			const ID idBlock(theStream);
-			activeLeaderIDs.insert(idBlock.getIDNum());
+			country.activeLeaderIDs.insert(idBlock.getIDNum());
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	keywords.registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
+}
 
-	parseStream(theStream);
-	clearRegisteredKeywords();
+EU4::Country::Country(
+	std::string countryTag,
+	const Version& theVersion, 
+	std::istream& theStream, 
+	const mappers::IdeaEffectMapper& ideaEffectMapper, 
+	const mappers::CultureGroups& cultureGroupsMapper
+): tag(countryTag)
+{
+	thread_local helpers::KeywordTable<Country, Version> keywords(registerKeywords);
+	keywords.parse(*this, theVersion, theStream);
 
-	if (primaryCulture.empty() && !historicalPrimaryCulture.empty()) primaryCulture = historicalPrimaryCulture;
-	if (religion.empty() && !historicalReligion.empty()) religion = historicalReligion;
+	if (primaryCulture.empty() && !historicalPrimaryCulture.empty()) primaryCulture = helpers::Symbol(historicalPrimaryCulture);
+	if (religion.empty() && !historicalReligion.empty()) religion = helpers::Symbol(historicalReligion);
 
 	determineJapaneseRelations();
 	determineInvestments(ideaEffectMapper);
@@ -263,6 +269,16 @@ EU4::Country::Country(
 	if (government == "republic" || government == "theocracy") historicalEntry.monarchy = false;
 }
 
+void EU4::Country::fluctuateMapColor()
+{
+	if (!mapColorToFluctuate) return;
+	mapColorToFluctuate = false;
+
+	auto mapColor = nationalColors.getMapColor();
+	mapColor.RandomlyFlunctuate(30);
+	nationalColors.setMapColor(mapColor);
+}
+
 void EU4::Country::filterLeaders()
 {
 	for (const auto& leader : historicalLeaders)
@@ -524,7 +540,7 @@ void EU4::Country::determineLibertyDesire()
 		}
 		else
 		{
-			LOG(LogLevel::Warning) << "Unknown attitude type " << attitude << " while setting liberty desire for " << tag;
+			unknownAttitude = attitude;
 			libertyDesire = 95.0;
 		}
 	}
@@ -547,9 +563,9 @@ void EU4::Country::readFromCommonCountry(const std::string& fileName, const std:
 				nationalColors.setMapColor(color);
 			}
 		);
-		registerRegex("[a-zA-Z0-9_]+", commonItems::ignoreItem);
+		registerRegex("[a-zA-Z0-9_]+", helpers::ignoreItem);
 
-		parseFile(fullFilename);
+		parseStream(*theConfiguration.getEU4Definitions().open(fullFilename));
 	}
 }
 
@@ -642,7 +658,7 @@ double EU4::Country::getManufactoryDensity() const
 void EU4::Country::eatCountry(Country& target)
 {
 	// auto-cannibalism is forbidden
-	if (target.getTag() == tag) return;
+	if (target.tag == tag) return;
 
 	LOG(LogLevel::Info) << " - " << tag << " is assimilating " << target.getTag();
 
@@ -657,8 +673,8 @@ void EU4::Country::eatCountry(Country& target)
 	for (auto& core: target.getCores())
 	{
 		addCore(core);
-		core->addCore(tag);
-		core->removeCore(target.tag);
+		core->addCore(tag.getString());
+		core->removeCore(target.tag.getString());
 	}
 
 	// everything else, do only if this country actually currently exists
@@ -667,8 +683,8 @@ void EU4::Country::eatCountry(Country& target)
 		// acquire target's provinces
 		for (const auto& province: target.provinces)
 		{
-			province->setOwnerString(tag);
-			province->setControllerString(tag);
+			province->setOwnerString(tag.getString());
+			province->setControllerString(tag.getString());
 			addProvince(province);
 		}
 
@@ -712,10 +728,10 @@ bool EU4::Country::cultureSurvivesInCores(const std::map<std::string, std::share
 	for (const auto& core: cores)
 	{
 		if (core->getOwnerString().empty()) continue;
-		if (core->getCulturePercent(primaryCulture) >= 0.5) continue;
+		if (core->getCulturePercent(primaryCulture.getString()) >= 0.5) continue;
 
 		auto owner = theCountries.find(core->getOwnerString());
-		if (owner != theCountries.end() && owner->second->getPrimaryCulture() != primaryCulture)
+		if (owner != theCountries.end() && owner->second->primaryCulture != primaryCulture)
 		{
 			return true;
 		}
@@ -5,6 +5,7 @@
 #include "../../Mappers/CultureGroups/CultureGroups.h"
 #include "../../Mappers/UnitTypes/UnitTypeMapper.h"
 #include "../../Mappers/IdeaEffects/IdeaEffectMapper.h"
+#include "../../Helpers/Symbols.h"
 #include "newParser.h"
 #include <memory>
 #include <set>
@@ -13,6 +14,7 @@
 #include "../Leader/EU4Leader.h"
 #include "../Relations/EU4RelationDetails.h"
 #include "../Provinces/EU4Province.h"
+#include "../../Helpers/KeywordTable.h"
 
 namespace EU4
 {
@@ -53,22 +55,26 @@ namespace EU4
 		void takeArmies(std::shared_ptr<Country>);
 		void clearArmies();
 		void viveLaRevolution(const bool revolting) { revolutionary = revolting; }
-		void setTag(const std::string& _tag) { tag = _tag; }
+		void setTag(const std::string& _tag) { tag = helpers::Symbol(_tag); }
 		void dropMinorityCultures();
 		void filterLeaders();
+		void fluctuateMapColor(); // adjusts a map color read from the save, called serially so runs stay repeatable
 		void resolveRegimentTypes(const mappers::UnitTypeMapper& unitTypeMapper);
 		void buildManufactoryCount(const std::map<std::string, std::shared_ptr<Country>>& theCountries);
 		void increaseMfgTransfer(const int increase) { mfgTransfer += increase; }
 
-		[[nodiscard]] const auto& getTag() const { return tag; }
+		[[nodiscard]] const auto& getTag() const { return tag.getString(); }
+		[[nodiscard]] auto getTagSymbol() const { return tag; }
 		[[nodiscard]] auto getCapital() const { return capital; }
 		[[nodiscard]] auto getInHRE() const { return inHRE; }
 		[[nodiscard]] auto getHolyRomanEmperor() const { return holyRomanEmperor; }
 		[[nodiscard]] auto getCelestialEmperor() const { return celestialEmperor; }
 		[[nodiscard]] const auto& getTechGroup() const { return techGroup; }
 		[[nodiscard]] auto getIsolationism() const { return isolationism; }
-		[[nodiscard]] const auto& getPrimaryCulture() const { return primaryCulture; }
-		[[nodiscard]] const auto& getReligion() const { return religion; }
+		[[nodiscard]] const auto& getPrimaryCulture() const { return primaryCulture.getString(); }
+		[[nodiscard]] const auto& getReligion() const { return religion.getString(); }
+		[[nodiscard]] auto getPrimaryCultureSymbol() const { return primaryCulture; }
+		[[nodiscard]] auto getReligionSymbol() const { return religion; }
 		[[nodiscard]] auto getScore() const { return score; }
 		[[nodiscard]] auto getStability() const { return stability; }
 		[[nodiscard]] auto getAverageAutonomy() const { return averageAutonomy; }
@@ -100,6 +106,7 @@ namespace EU4
 		[[nodiscard]] auto isCustom() const { return customNation; }
 		[[nodiscard]] auto isColony() const { return colony; }
 		[[nodiscard]] auto getLibertyDesire() const { return libertyDesire; }
+		[[nodiscard]] const auto& getUnknownAttitude() const { return unknownAttitude; }
 		[[nodiscard]] auto isRevolutionary() const { return revolutionary; }
 		[[nodiscard]] auto getManufactoryCount() const { return mfgCount + mfgTransfer; }
 		[[nodiscard]] const auto& getRandomName() const { return randomName; }
@@ -134,6 +141,7 @@ namespace EU4
 		[[nodiscard]] double getManufactoryDensity() const;
 
 	private:
+		static void registerKeywords(helpers::KeywordTable<Country, Version>& keywords);
 		void determineJapaneseRelations();
 		void determineInvestments(const mappers::IdeaEffectMapper& ideaEffectMapper);
 		void determineLibertyDesire();
@@ -141,7 +149,7 @@ namespace EU4
 		void clearProvinces();
 		void clearCores();
 
-		std::string tag; // the tag for the EU4 nation
+		helpers::Symbol tag; // the tag for the EU4 nation
 		std::vector<std::shared_ptr<Province>> provinces; // we're pointing to main province repository in provinces class
 		std::vector<std::shared_ptr<Province>> cores; // ditto
 		bool inHRE = false; // if this country is an HRE member
@@ -152,10 +160,10 @@ namespace EU4
 		std::string techGroup; // the tech group for this nation
 		std::vector<bool> embracedInstitutions; // the institutions this nation has embraced
 		int isolationism = 1; // the isolationism of the country (for Shinto nations with Mandate of Heaven)
-		std::string primaryCulture; // the primary EU4 culture of this nation
+		helpers::Symbol primaryCulture; // the primary EU4 culture of this nation
 		std::string historicalPrimaryCulture;
 		std::set<std::string> acceptedCultures;  // this is not used at the moment.
-		std::string religion; // the accepted religion of this country
+		helpers::Symbol religion; // the accepted religion of this country
 		std::string historicalReligion;
 		double score = 0.0;
 		double admTech = 0.0; // the admin tech of this nation
@@ -207,6 +215,8 @@ namespace EU4
 		std::string overlord;
 		std::string colonialRegion; // the colonial region, if this country is a colony
 		double libertyDesire = 0.0; // the amount of liberty desire
+		std::string unknownAttitude; // set when the attitude had no liberty desire, for warning after countries are built
+		bool mapColorToFluctuate = false; // set when the save gave a map color, adjusted after countries are built
 		std::string randomName; // the new name of this nation in Random World
 		bool revolutionary = false; // does this country wave the glorious tri-colored banner of the revolution
 		std::set<std::string> governmentReforms;
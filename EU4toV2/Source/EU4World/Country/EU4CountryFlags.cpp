@@ -1,14 +1,15 @@
 #include "EU4CountryFlags.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::EU4CountryFlags::EU4CountryFlags(std::istream& theStream)
 {
 	registerRegex("[a-zA-Z0-9_]+", [this](const std::string& flag, std::istream& theStream)
 		{
-			commonItems::ignoreItem(flag, theStream);
+			helpers::ignoreItem(flag, theStream);
 			flags.insert(flag);
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
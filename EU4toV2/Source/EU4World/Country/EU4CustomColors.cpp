@@ -1,5 +1,6 @@
 #include "EU4CustomColors.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::CustomColors::CustomColors(std::istream& theStream)
 {
@@ -30,7 +31,7 @@ EU4::CustomColors::CustomColors(std::istream& theStream)
 		{
 			customColors.flagColors = commonItems::Color(theStream);
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
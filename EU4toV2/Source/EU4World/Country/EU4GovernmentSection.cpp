@@ -1,5 +1,6 @@
 #include "EU4GovernmentSection.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 #include "EU4ReformStackSection.h"
 
 EU4::GovernmentSection::GovernmentSection(std::istream& theStream)
@@ -14,7 +15,7 @@ EU4::GovernmentSection::GovernmentSection(std::istream& theStream)
 			const ReformStackSection refStack(theStream);
 			reformStack = refStack.getReforms();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
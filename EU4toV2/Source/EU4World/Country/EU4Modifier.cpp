@@ -1,5 +1,6 @@
 #include "EU4Modifier.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::EU4Modifier::EU4Modifier(std::istream& theStream)
 {
@@ -8,7 +9,7 @@ EU4::EU4Modifier::EU4Modifier(std::istream& theStream)
 			const commonItems::singleString modifierStr(theStream);
 			modifier = modifierStr.getString();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
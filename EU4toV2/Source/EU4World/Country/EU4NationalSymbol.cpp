@@ -1,5 +1,6 @@
 #include "EU4NationalSymbol.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::NationalSymbol::NationalSymbol(std::istream& theStream)
 {
@@ -21,7 +22,7 @@ EU4::NationalSymbol::NationalSymbol(std::istream& theStream)
 			customColors = theSection;
 			customColorsInitialized = true;
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
@@ -1,5 +1,6 @@
 #include "EU4ReformStackSection.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::ReformStackSection::ReformStackSection(std::istream& theStream)
 {
@@ -8,7 +9,7 @@ EU4::ReformStackSection::ReformStackSection(std::istream& theStream)
 		const commonItems::stringList reformList(theStream);
 		for (const auto& reform : reformList.getStrings()) reforms.insert(reform);
 	});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
@@ -1,5 +1,6 @@
 #include "EU4Technology.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::EU4Technology::EU4Technology(std::istream& theStream)
 {
@@ -18,7 +19,7 @@ EU4::EU4Technology::EU4Technology(std::istream& theStream)
 			const commonItems::singleInt techInt(theStream);
 			mil = techInt.getInt();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
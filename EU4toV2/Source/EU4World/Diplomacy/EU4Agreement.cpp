@@ -1,5 +1,6 @@
 #include "EU4Agreement.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::EU4Agreement::EU4Agreement(std::istream& theStream)
 {
@@ -28,7 +29,7 @@ EU4::EU4Agreement::EU4Agreement(std::istream& theStream)
 			const commonItems::singleString secondStr(theStream);
 			targetTag = secondStr.getString();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
@@ -1,5 +1,6 @@
 #include "EU4Diplomacy.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::EU4Diplomacy::EU4Diplomacy(std::istream& theStream)
 {
@@ -29,7 +30,7 @@ EU4::EU4Diplomacy::EU4Diplomacy(std::istream& theStream)
 			newAgreement.setAgreementType("vassal");
 			agreements.push_back(newAgreement);
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
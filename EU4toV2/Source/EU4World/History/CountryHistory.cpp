@@ -1,16 +1,11 @@
 #include "CountryHistory.h"
 #include "CountryHistoryDate.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/DayNumbers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::CountryHistory::CountryHistory(std::istream& theStream)
 {
-	registerRegex("\\d+\\.\\d+\\.\\d+", [this](const std::string& unused, std::istream& theStream)
-		{
-			const CountryHistoryDate theDate(theStream, std::string());
-			auto incLeaders = theDate.getLeaders();
-			leaders.insert(leaders.end(), incLeaders.begin(), incLeaders.end());
-			if (!theDate.getDynasty().empty()) dynasty = theDate.getDynasty();
-		});
 	registerKeyword("primary_culture", [this](const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString primaryCultureStr(theStream);
@@ -21,7 +16,19 @@ EU4::CountryHistory::CountryHistory(std::istream& theStream)
 			const commonItems::singleString religionStr(theStream);
 			religion = religionStr.getString();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", [this](const std::string& key, std::istream& theStream)
+		{
+			// Dated entries are recognized by scanning the key instead of matching another regex.
+			if (!helpers::parseDayNumber(key))
+			{
+				helpers::skipValue(theStream);
+				return;
+			}
+			const CountryHistoryDate theDate(theStream, std::string());
+			auto incLeaders = theDate.getLeaders();
+			leaders.insert(leaders.end(), incLeaders.begin(), incLeaders.end());
+			if (!theDate.getDynasty().empty()) dynasty = theDate.getDynasty();
+		});
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
@@ -1,5 +1,6 @@
 #include "CountryHistoryDate.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::CountryHistoryDate::CountryHistoryDate(std::istream& theStream, const std::string& leaderClass)
 {
@@ -20,7 +21,7 @@ EU4::CountryHistoryDate::CountryHistoryDate(std::istream& theStream, const std::
 			const commonItems::singleString dynastyString(theStream);
 			if (leaderClass == "monarch") dynasty = dynastyString.getString();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
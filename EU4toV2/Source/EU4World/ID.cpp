@@ -1,5 +1,6 @@
 #include "ID.h"
 #include "ParserHelpers.h"
+#include "../Helpers/RawBlocks.h"
 #include "Log.h"
 
 EU4::ID::ID(std::istream& theStream)
@@ -16,7 +17,7 @@ EU4::ID::ID(std::istream& theStream)
 			IDType = theNum.getInt();
 		}
 	);
-	registerRegex("[a-zA-Z0-9_]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
@@ -2,6 +2,7 @@
 #include "../ID.h"
 #include "Log.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::Leader::Leader(std::istream& theStream)
 {
@@ -17,7 +18,7 @@ EU4::Leader::Leader(std::istream& theStream)
 		});
 	registerKeyword("female", [this](const std::string& unused, std::istream& theStream)
 		{
-			commonItems::ignoreItem(unused, theStream);
+			helpers::ignoreItem(unused, theStream);
 			female = true;
 		});
 	registerKeyword("manuever", [this](const std::string& unused, std::istream& theStream)
@@ -55,7 +56,7 @@ EU4::Leader::Leader(std::istream& theStream)
 			const ID theID(theStream);
 			leaderID = theID.getIDNum();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
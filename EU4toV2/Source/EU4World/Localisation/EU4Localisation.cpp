@@ -1,70 +1,113 @@
 #include "EU4Localisation.h"
-#include <fstream>
-#include <vector>
+#include <algorithm>
 #include <set>
 #include "OSCompatibilityLayer.h"
 #include "../../Configuration.h"
-#include <filesystem>
-namespace fs = std::filesystem;
+#include "../../Helpers/ThreadPool.h"
 
-EU4::EU4Localisation::EU4Localisation()
+void EU4::EU4Localisation::readFromAllLocalisationFolders()
 {
-	readFromAllFilesInFolder(theConfiguration.getEU4Path() + "/localisation");
-	for (const auto& itr : theConfiguration.getEU4Mods())
+	// Mod files come after the game's and the replace folders after all regular files.
+	auto fileNames = theConfiguration.getEU4Files().list("localisation");
+	for (auto& fileName: theConfiguration.getEU4Files().list("localisation/replace")) fileNames.push_back(std::move(fileName));
+	readFromFiles(fileNames);
+}
+
+void EU4::EU4Localisation::readFromFile(const std::string& fileName)
+{
+	merge(parseFile(fileName));
+}
+
+void EU4::EU4Localisation::readFromAllFilesInFolder(const std::string& folderPath)
+{
+	readFromFiles(listFilesInFolder(folderPath));
+}
+
+std::vector<std::string> EU4::EU4Localisation::listFilesInFolder(const std::string& folderPath)
+{
+	std::set<std::string> fileNames;
+	Utils::GetAllFilesInFolder(folderPath, fileNames);
+
+	std::vector<std::string> filePaths;
+	filePaths.reserve(fileNames.size());
+	for (const auto& fileName : fileNames)
 	{
-		readFromAllFilesInFolder(itr + "/localisation");
-		readFromAllFilesInFolder(itr + "/localisation/replace");
+		filePaths.push_back(folderPath + '/' + fileName);
 	}
+	return filePaths;
 }
 
-void EU4::EU4Localisation::readFromFile(const std::string& fileName)
+void EU4::EU4Localisation::readFromFiles(const std::vector<std::string>& fileNames)
+{
+	std::vector<ParsedFile> parsedFiles(fileNames.size());
+	helpers::ThreadPool::shared().parallelFor(fileNames.size(), [&fileNames, &parsedFiles](const size_t index)
+		{
+			parsedFiles[index] = parseFile(fileNames[index]);
+		});
+
+	size_t entryCount = localisations.size();
+	for (const auto& parsedFile: parsedFiles) entryCount += parsedFile.entries.size();
+	localisations.reserve(entryCount);
+
+	for (auto& parsedFile: parsedFiles)
+	{
+		merge(std::move(parsedFile));
+	}
+}
+
+EU4::EU4Localisation::ParsedFile EU4::EU4Localisation::parseFile(const std::string& fileName)
 {
-	std::ifstream in(fs::u8path(fileName));
+	ParsedFile parsedFile;
+	auto file = std::make_unique<helpers::MappedFile>(fileName);
+	if (!file->isOpen()) return parsedFile;
 
-	const int maxLineLength = 10000;	// the maximum line length
-	char line[maxLineLength];			// the line being processed
+	auto remaining = file->getView();
+	const auto nextLine = [&remaining]
+	{
+		const auto lineEnd = remaining.find('\n');
+		const auto line = remaining.substr(0, lineEnd);
+		remaining.remove_prefix(lineEnd == std::string_view::npos ? remaining.size() : lineEnd + 1);
+		return line;
+	};
 
 	// First line is the language like "l_english:"
-	in.getline(line, maxLineLength);
-	const auto& language = determineLanguageForFile(removeUTF8BOM(line));
-	if (language.empty())
+	parsedFile.language = determineLanguageForFile(removeUTF8BOM(nextLine()));
+	if (parsedFile.language.empty())
 	{
-		return;
+		return parsedFile;
 	}
+	parsedFile.file = std::move(file);
 
 	// Subsequent lines are 'KEY: "Text"'
-	while (!in.eof())
+	while (!remaining.empty())
 	{
-		in.getline(line, maxLineLength);
-		if (!in.eof())
+		const auto [key, currentLocalisation] = determineKeyLocalisationPair(removeUTF8BOM(nextLine()));
+		if (!key.empty() && !currentLocalisation.empty())
 		{
-			const auto keyLocalisationPair = determineKeyLocalisationPair(removeUTF8BOM(line));
-			const std::string& key = keyLocalisationPair.first;
-			const std::string& currentLocalisation = keyLocalisationPair.second;
-			if (!key.empty() && !currentLocalisation.empty())
-			{
-				localisations[key][language] = currentLocalisation;
-			}
+			parsedFile.entries.emplace_back(key, currentLocalisation);
 		}
 	}
+	return parsedFile;
 }
 
-void EU4::EU4Localisation::readFromAllFilesInFolder(const std::string& folderPath)
+void EU4::EU4Localisation::merge(ParsedFile&& parsedFile)
 {
-	// Get all files in the folder.
-	std::set<std::string> fileNames;
-	Utils::GetAllFilesInFolder(folderPath, fileNames);
+	if (!parsedFile.file) return;
 
-	// Read all these files.
-	for (const auto& fileName : fileNames)
+	const auto language = parsedFile.language;
+	for (const auto& [key, currentLocalisation]: parsedFile.entries)
 	{
-		readFromFile(folderPath + '/' + fileName);
+		auto& localisationsByLanguage = localisations[key];
+		const auto existing = std::find_if(localisationsByLanguage.begin(), localisationsByLanguage.end(), [language](const auto& entry) { return entry.first == language; });
+		if (existing != localisationsByLanguage.end()) existing->second = currentLocalisation;
+		else localisationsByLanguage.emplace_back(language, currentLocalisation);
 	}
+	files.push_back(std::move(parsedFile.file));
 }
 
-const std::string& EU4::EU4Localisation::getText(const std::string& key, const std::string& language) const
+std::string_view EU4::EU4Localisation::getText(const std::string_view key, const std::string_view language) const
 {
-	static const std::string noLocalisation; // used if there's no localization
+	static const std::string_view noLocalisation; // used if there's no localization
 
 	const auto keyFindIter = localisations.find(key);
 	if (keyFindIter == localisations.end())
@@ -72,7 +115,7 @@ const std::string& EU4::EU4Localisation::getText(const std::string& key, const s
 		return noLocalisation;
 	}
 	const auto& localisationsByLanguage = keyFindIter->second;
-	const auto& languageFindIter = localisationsByLanguage.find(language);
+	const auto languageFindIter = std::find_if(localisationsByLanguage.begin(), localisationsByLanguage.end(), [language](const auto& entry) { return entry.first == language; });
 	if (languageFindIter == localisationsByLanguage.end())
 	{
 		return noLocalisation;
@@ -81,9 +124,9 @@ const std::string& EU4::EU4Localisation::getText(const std::string& key, const s
 	return languageFindIter->second;
 }
 
-const std::map<std::string, std::string>& EU4::EU4Localisation::getTextInEachLanguage(const std::string& key) const
+const EU4::EU4Localisation::LanguageToLocalisationMap& EU4::EU4Localisation::getTextInEachLanguage(const std::string_view key) const
 {
-	static const std::map<std::string, std::string> noLocalisation; // used if there's no localization
+	static const LanguageToLocalisationMap noLocalisation; // used if there's no localization
 
 	const auto& keyFindIter = localisations.find(key);
 	if (keyFindIter == localisations.end())
@@ -94,9 +137,9 @@ const std::map<std::string, std::string>& EU4::EU4Localisation::getTextInEachLan
 	return keyFindIter->second;
 }
 
-std::string EU4::EU4Localisation::determineLanguageForFile(const std::string& text)
+std::string_view EU4::EU4Localisation::determineLanguageForFile(const std::string_view text)
 {
-	static const std::string noLanguageIndicated;	// used when no language is indicated
+	static const std::string_view noLanguageIndicated;	// used when no language is indicated
 
 	if (text.size() < 2 || text[0] != 'l' || text[1] != '_')
 	{	// Not in the desired format - no "l_"
@@ -104,7 +147,7 @@ std::string EU4::EU4Localisation::determineLanguageForFile(const std::string& te
 	}
 	const size_t beginPos = 2;	// Skip l_ for our language name.
 	const auto endPos = text.find(':', beginPos);	// the end of the language name
-	if (endPos == std::string::npos)
+	if (endPos == std::string_view::npos)
 	{	// Not in the desired format - no ":"
 		return noLanguageIndicated;
 	}
@@ -112,18 +155,18 @@ std::string EU4::EU4Localisation::determineLanguageForFile(const std::string& te
 	return text.substr(beginPos, endPos - beginPos);
 }
 
-std::pair<std::string, std::string> EU4::EU4Localisation::determineKeyLocalisationPair(const std::string& text)
+std::pair<std::string_view, std::string_view> EU4::EU4Localisation::determineKeyLocalisationPair(const std::string_view text)
 {
-	static const std::pair<std::string, std::string> noLocalisationPair;	// used when there's no localization pair
+	static const std::pair<std::string_view, std::string_view> noLocalisationPair;	// used when there's no localization pair
 
 	const auto keyBeginPos = text.find_first_not_of(' ');	// the first non-space character
-	if (keyBeginPos == std::string::npos)
+	if (keyBeginPos == std::string_view::npos)
 	{
 		return noLocalisationPair;
 	}
 	const auto keyEndPos = text.find_first_of(':', keyBeginPos + 1); // the end of the key
 	const auto quotePos = text.find_first_of('"', keyEndPos); // the beginning of the string literal
-	if (quotePos == std::string::npos)
+	if (quotePos == std::string_view::npos)
 	{
 		return noLocalisationPair;
 	}
@@ -132,7 +175,7 @@ std::pair<std::string, std::string> EU4::EU4Localisation::determineKeyLocalisati
 	return std::make_pair(text.substr(keyBeginPos, keyEndPos - keyBeginPos), text.substr(localisationBeginPos, localisationEndPos - localisationBeginPos));
 }
 
-std::string EU4::EU4Localisation::removeUTF8BOM(const std::string& text)
+std::string_view EU4::EU4Localisation::removeUTF8BOM(const std::string_view text)
 {
 	if (text.size() >= 3 && text[0] == '\xEF' && text[1] == '\xBB' && text[2] == '\xBF')
 	{
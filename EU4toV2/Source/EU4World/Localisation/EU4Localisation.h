@@ -1,19 +1,26 @@
 #ifndef EU4_LOCALISATION_H
 #define EU4_LOCALISATION_H
 
-#include <map>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+#include "../../Helpers/MappedFile.h"
 
 namespace EU4
 {
-	// Holds a map from key to localized text for all languages in which 
-	// the localization is provided.
+	// Index over all localisation files of the install and the enabled mods, in every
+	// language they provide. The files are read once and stay mapped, keys and texts
+	// point into them, so everyone needing localisation should query the same index
+	// instead of reading the files again.
 	class EU4Localisation
 	{
 	public:
-		EU4Localisation();
+		// Adds the localisation folders of the install and then those of every mod, so that
+		// mod texts override the game's.
+		void readFromAllLocalisationFolders();
 
 		// Adds all localizations found in the specified file. The file should begin with
 		// a line like "l_english:" to indicate what language the texts are in.
@@ -21,31 +28,49 @@ namespace EU4
 		// Adds all localizations found in files in the specified folder as per ReadFromFile().
 		void readFromAllFilesInFolder(const std::string& folderPath);
 
+		typedef std::vector<std::pair<std::string_view, std::string_view>> LanguageToLocalisationMap; // language, text
+
 		// Returns the localized text for the given key in the specified language. Returns
-		// an empty string if no such localization is available.
-		[[nodiscard]] const std::string& getText(const std::string& key, const std::string& language) const;
-		// Returns the localized text for the given key in each language - the returned map is from
-		// language to localized text.
-		[[nodiscard]] const std::map<std::string, std::string>& getTextInEachLanguage(const std::string& key) const;
+		// an empty string if no such localization is available. Where several files define a
+		// key, the one read last wins.
+		[[nodiscard]] std::string_view getText(std::string_view key, std::string_view language) const;
+		// Returns the localized text for the given key in each language, as pairs of language
+		// and localized text.
+		[[nodiscard]] const LanguageToLocalisationMap& getTextInEachLanguage(std::string_view key) const;
 
 	private:
+		// One file's worth of localisations, parsed but not yet merged into the index.
+		struct ParsedFile
+		{
+			std::unique_ptr<helpers::MappedFile> file;
+			std::string_view language;
+			std::vector<std::pair<std::string_view, std::string_view>> entries; // key, text
+		};
+
+		static std::vector<std::string> listFilesInFolder(const std::string& folderPath);
+		static ParsedFile parseFile(const std::string& fileName);
+
+		// Parses the files concurrently, then merges them in the given order so later files
+		// override earlier ones exactly as if they had been read one after the other.
+		void readFromFiles(const std::vector<std::string>& fileNames);
+		void merge(ParsedFile&& parsedFile);
+
 		// Returns the language name from text in the form "l_english:". Returns an empty string
 		// if the text doesn't fit this format.
-		static std::string determineLanguageForFile(const std::string& text);
+		static std::string_view determineLanguageForFile(std::string_view text);
 		
 		// Returns the localization from text in the form 'KEY: "Localization"'. Returns a pair
 		// with empty strings if the text doesn't fit this format. Additional spaces around the
 		// elements can be included and are ignored.
-		static std::pair<std::string, std::string> determineKeyLocalisationPair(const std::string& text);
+		static std::pair<std::string_view, std::string_view> determineKeyLocalisationPair(std::string_view text);
 
 		// Removes a UTF-8 BOM from the beginning of the text, if present. (These are added by the
 		// CK2-EU4 converter.)
-		static std::string removeUTF8BOM(const std::string& text);
+		static std::string_view removeUTF8BOM(std::string_view text);
 
-		typedef std::map<std::string, std::string> LanguageToLocalisationMap;
-		typedef std::unordered_map<std::string, LanguageToLocalisationMap> KeyToLocalisationsMap;
-		KeyToLocalisationsMap localisations;	// a map between keys and localizations
+		std::vector<std::unique_ptr<helpers::MappedFile>> files; // everything below points into these
+		std::unordered_map<std::string_view, LanguageToLocalisationMap> localisations;	// a map between keys and localizations
 	};
 }
 
-#endif // EU4_LOCALISATION_H
\ No newline at end of file
+#endif // EU4_LOCALISATION_H
@@ -1,7 +1,5 @@
 #include "Modifiers.h"
 #include "../../Configuration.h"
-#include "OSCompatibilityLayer.h"
-#include <set>
 
 EU4::Modifiers::Modifiers()
 {
@@ -25,26 +23,9 @@ void EU4::Modifiers::initialize()
 
 void EU4::Modifiers::processFolder(const std::string& folderName)
 {
-	if (Utils::doesFolderExist(theConfiguration.getEU4Path() + "/common/" + folderName))
+	for (const auto& filename : theConfiguration.getEU4Files().list("common/" + folderName))
 	{
-		std::set<std::string> filenames;
-		Utils::GetAllFilesInFolder(theConfiguration.getEU4Path() + "/common/" + folderName + "/", filenames);
-		for (const auto& filename : filenames)
-		{
-			parseFile(theConfiguration.getEU4Path() + "/common/" + folderName + "/" + filename);
-		}
-	}
-	for (const auto& modName : theConfiguration.getEU4Mods())
-	{
-		if (Utils::doesFolderExist(modName + "/common/" + folderName))
-		{
-			std::set<std::string> filenames;
-			Utils::GetAllFilesInFolder(modName + "/common/" + folderName + "/", filenames);
-			for (const auto& filename : filenames)
-			{
-				parseFile(modName + "/common/" + folderName + "/" + filename);
-			}
-		}
+		parseStream(*theConfiguration.getEU4Definitions().open(filename));
 	}
 }
 
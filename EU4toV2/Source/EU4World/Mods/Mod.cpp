@@ -16,6 +16,16 @@ EU4::Mod::Mod(std::istream& theStream)
 	parseStream(theStream);
 	clearRegisteredKeywords();
 
+	determineCompression();
+}
+
+EU4::Mod::Mod(std::string theName, std::string thePath): name(std::move(theName)), path(std::move(thePath))
+{
+	determineCompression();
+}
+
+void EU4::Mod::determineCompression()
+{
 	if (!path.empty())
 	{
 		const auto lastDot = path.find_last_of('.');
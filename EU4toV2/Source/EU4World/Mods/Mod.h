@@ -9,6 +9,7 @@ namespace EU4
 	{
 	public:
 		explicit Mod(std::istream& theStream);
+		Mod(std::string theName, std::string thePath);
 		
 		[[nodiscard]] const auto& getName() const { return name; }
 		[[nodiscard]] const auto& getPath() const { return path; }
@@ -16,6 +17,8 @@ namespace EU4
 		[[nodiscard]] auto isCompressed() const { return compressed; }
 
 	private:
+		void determineCompression();
+
 		std::string name;
 		std::string path;
 		bool compressed = false;
@@ -0,0 +1,131 @@
+#include "ModDescriptorIndex.h"
+#include "../../Helpers/ThreadPool.h"
+#include "Log.h"
+#include <filesystem>
+#include <fstream>
+#include <random>
+namespace fs = std::filesystem;
+
+namespace
+{
+	// Bump whenever the line layout changes, older indices are then ignored.
+	const std::string INDEX_HEADER = "EU4toVic2 mod descriptor index 1";
+}
+
+EU4::ModDescriptorIndex::ModDescriptorIndex(std::string theIndexPath): indexPath(std::move(theIndexPath))
+{
+	std::ifstream indexFile(fs::u8path(indexPath));
+	std::string line;
+	if (!std::getline(indexFile, line) || line != INDEX_HEADER) return;
+
+	// descriptor path, size, modification time, name and mod path, separated by tabs
+	while (std::getline(indexFile, line))
+	{
+		std::vector<std::string> fields;
+		size_t fieldStart = 0;
+		for (auto tab = line.find('\t'); tab != std::string::npos; tab = line.find('\t', fieldStart))
+		{
+			fields.push_back(line.substr(fieldStart, tab - fieldStart));
+			fieldStart = tab + 1;
+		}
+		fields.push_back(line.substr(fieldStart));
+		if (fields.size() != 5) continue;
+
+		try
+		{
+			Entry entry;
+			entry.size = std::stoull(fields[1]);
+			entry.modified = std::stoll(fields[2]);
+			entry.name = fields[3];
+			entry.path = fields[4];
+			entries.insert(std::make_pair(fields[0], entry));
+		}
+		catch (std::exception&)
+		{
+			// A damaged line only costs re-reading that descriptor.
+		}
+	}
+}
+
+std::vector<std::optional<EU4::Mod>> EU4::ModDescriptorIndex::read(const std::vector<std::string>& descriptorPaths)
+{
+	std::vector<std::optional<Mod>> mods(descriptorPaths.size());
+	std::vector<std::optional<Entry>> parsedEntries(descriptorPaths.size());
+
+	helpers::ThreadPool::shared().parallelFor(descriptorPaths.size(), [this, &descriptorPaths, &mods, &parsedEntries](const size_t index)
+		{
+			const auto& descriptorPath = descriptorPaths[index];
+			auto current = statDescriptor(descriptorPath);
+			if (!current) return;
+
+			if (const auto cached = entries.find(descriptorPath);
+				 cached != entries.end() && cached->second.size == current->size && cached->second.modified == current->modified)
+			{
+				mods[index].emplace(cached->second.name, cached->second.path);
+				return;
+			}
+
+			try
+			{
+				std::ifstream modFile(fs::u8path(descriptorPath));
+				if (!modFile.is_open()) return;
+				const auto& theMod = mods[index].emplace(modFile);
+				current->name = theMod.getName();
+				current->path = theMod.getPath();
+				parsedEntries[index] = current;
+			}
+			catch (std::exception&)
+			{
+				mods[index].reset();
+			}
+		});
+
+	for (size_t index = 0; index < descriptorPaths.size(); ++index)
+	{
+		if (!mods[index]) continue;
+		seen.insert(descriptorPaths[index]);
+		if (parsedEntries[index])
+		{
+			entries[descriptorPaths[index]] = *parsedEntries[index];
+			changed = true;
+		}
+	}
+	return mods;
+}
+
+void EU4::ModDescriptorIndex::save() const
+{
+	if (!changed && seen.size() == entries.size()) return;
+
+	// Unique, so runs sharing the mod folder never write into the same file.
+	const auto temporaryPath = indexPath + ".tmp" + std::to_string(std::random_device()());
+	std::error_code error;
+	fs::create_directories(fs::u8path(indexPath).parent_path(), error);
+	std::ofstream indexFile(fs::u8path(temporaryPath), std::ios::trunc);
+	indexFile << INDEX_HEADER << '\n';
+	for (const auto& descriptorPath: seen)
+	{
+		const auto& entry = entries.at(descriptorPath);
+		indexFile << descriptorPath << '\t' << entry.size << '\t' << entry.modified << '\t' << entry.name << '\t' << entry.path << '\n';
+	}
+	indexFile.close();
+
+	if (!indexFile.fail()) fs::rename(fs::u8path(temporaryPath), fs::u8path(indexPath), error);
+	if (indexFile.fail() || error)
+	{
+		LOG(LogLevel::Warning) << "Could not store the mod descriptor index at " << indexPath;
+		fs::remove(fs::u8path(temporaryPath), error);
+	}
+}
+
+std::optional<EU4::ModDescriptorIndex::Entry> EU4::ModDescriptorIndex::statDescriptor(const std::string& descriptorPath)
+{
+	std::error_code error;
+	const auto path = fs::u8path(descriptorPath);
+	Entry entry;
+	entry.size = fs::file_size(path, error);
+	if (error) return std::nullopt;
+	entry.modified = static_cast<long long>(fs::last_write_time(path, error).time_since_epoch().count());
+	if (error) return std::nullopt;
+	return entry;
+}
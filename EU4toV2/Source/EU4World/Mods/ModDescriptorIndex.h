@@ -0,0 +1,47 @@
+#ifndef MOD_DESCRIPTOR_INDEX_H
+#define MOD_DESCRIPTOR_INDEX_H
+
+#include "Mod.h"
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace EU4
+{
+	// Names and paths out of .mod and descriptor.mod files, remembered across runs together with
+	// each file's size and modification time. Only descriptors that are new or changed since the
+	// last run are parsed again, and those are parsed in parallel.
+	class ModDescriptorIndex
+	{
+	public:
+		explicit ModDescriptorIndex(std::string theIndexPath);
+
+		// One entry per descriptor path, empty where the descriptor is missing or can't be parsed.
+		[[nodiscard]] std::vector<std::optional<Mod>> read(const std::vector<std::string>& descriptorPaths);
+
+		// Writes out the descriptors seen by read() in this run. Entries for descriptors that are
+		// gone are dropped.
+		void save() const;
+
+	private:
+		struct Entry
+		{
+			uintmax_t size = 0;
+			long long modified = 0;
+			std::string name;
+			std::string path;
+		};
+
+		[[nodiscard]] static std::optional<Entry> statDescriptor(const std::string& descriptorPath);
+
+		std::string indexPath;
+		std::map<std::string, Entry> entries; // descriptor path, entry
+		std::set<std::string> seen;
+		bool changed = false;
+	};
+}
+
+#endif // MOD_DESCRIPTOR_INDEX_H
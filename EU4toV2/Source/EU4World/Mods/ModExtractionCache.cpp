@@ -0,0 +1,98 @@
+#include "ModExtractionCache.h"
+#include "../../Helpers/ContentHash.h"
+#include "../../Helpers/MappedFile.h"
+#include "Log.h"
+#include <filesystem>
+#include <fstream>
+#include <random>
+namespace fs = std::filesystem;
+
+namespace
+{
+	const std::string STAMP_FILE = ".extracted_from";
+}
+
+EU4::ModExtractionCache::ModExtractionCache(std::string theArchivePath, std::string theExtractedPath):
+	archivePath(std::move(theArchivePath)), extractedPath(std::move(theExtractedPath))
+{
+}
+
+bool EU4::ModExtractionCache::isUpToDate() const
+{
+	// Folders without a stamp are half-finished or older extractions and never trusted.
+	const auto stamp = readStamp(extractedPath);
+	if (!stamp) return false;
+	const auto archive = statArchive();
+	if (!archive || archive->size != stamp->size) return false;
+	if (archive->modified == stamp->modified) return true;
+
+	// Touched but maybe not changed - a copied or re-downloaded archive keeps its content.
+	auto current = *archive;
+	current.hash = hashArchive();
+	if (current.hash.empty() || current.hash != stamp->hash) return false;
+	writeStamp(extractedPath, current);
+	return true;
+}
+
+bool EU4::ModExtractionCache::refresh(const Extractor& extract) const
+{
+	auto stamp = statArchive();
+	if (!stamp) return false;
+	stamp->hash = hashArchive();
+	if (stamp->hash.empty()) return false;
+
+	// Unique per run, so two converters sharing a mods folder don't extract into each other.
+	const auto temporaryPath = extractedPath + ".tmp" + std::to_string(std::random_device()());
+	std::error_code error;
+	fs::remove_all(fs::u8path(temporaryPath), error);
+	if (!extract(archivePath, temporaryPath) || !writeStamp(temporaryPath, *stamp))
+	{
+		fs::remove_all(fs::u8path(temporaryPath), error);
+		return false;
+	}
+
+	fs::remove_all(fs::u8path(extractedPath), error);
+	fs::rename(fs::u8path(temporaryPath), fs::u8path(extractedPath), error);
+	if (error)
+	{
+		LOG(LogLevel::Warning) << "Could not move the extracted " << archivePath << " to " << extractedPath << ": " << error.message();
+		fs::remove_all(fs::u8path(temporaryPath), error);
+		return false;
+	}
+	return true;
+}
+
+std::optional<EU4::ModExtractionCache::Stamp> EU4::ModExtractionCache::statArchive() const
+{
+	std::error_code error;
+	const auto path = fs::u8path(archivePath);
+	Stamp stamp;
+	stamp.size = fs::file_size(path, error);
+	if (error) return std::nullopt;
+	stamp.modified = static_cast<long long>(fs::last_write_time(path, error).time_since_epoch().count());
+	if (error) return std::nullopt;
+	return stamp;
+}
+
+std::string EU4::ModExtractionCache::hashArchive() const
+{
+	const helpers::MappedFile archive(archivePath);
+	if (!archive.isOpen()) return std::string();
+	return helpers::ContentHash().update(archive.getView()).toString();
+}
+
+std::optional<EU4::ModExtractionCache::Stamp> EU4::ModExtractionCache::readStamp(const std::string& folder)
+{
+	std::ifstream stampFile(fs::u8path(folder + "/" + STAMP_FILE));
+	Stamp stamp;
+	if (!(stampFile >> stamp.size >> stamp.modified >> stamp.hash)) return std::nullopt;
+	return stamp;
+}
+
+bool EU4::ModExtractionCache::writeStamp(const std::string& folder, const Stamp& stamp)
+{
+	std::ofstream stampFile(fs::u8path(folder + "/" + STAMP_FILE), std::ios::trunc);
+	stampFile << stamp.size << ' ' << stamp.modified << ' ' << stamp.hash << '\n';
+	stampFile.close();
+	return !stampFile.fail();
+}
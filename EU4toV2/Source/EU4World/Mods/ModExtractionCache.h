@@ -0,0 +1,49 @@
+#ifndef MOD_EXTRACTION_CACHE_H
+#define MOD_EXTRACTION_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace EU4
+{
+	// Keeps a compressed mod's extracted folder tied to the archive it came from. The folder
+	// carries a stamp of the archive's size, modification time and content hash, and is only
+	// reused while the archive still matches it. Extraction goes into a temporary folder that
+	// is renamed into place once complete, so an interrupted run never leaves a folder that
+	// looks usable.
+	class ModExtractionCache
+	{
+	public:
+		using Extractor = std::function<bool(const std::string& archivePath, const std::string& targetPath)>;
+
+		ModExtractionCache(std::string theArchivePath, std::string theExtractedPath);
+
+		[[nodiscard]] bool isUpToDate() const;
+
+		// Extracts the archive anew with the given function and swaps the result in for the
+		// previous extraction. Returns false, leaving the previous extraction alone, on failure.
+		[[nodiscard]] bool refresh(const Extractor& extract) const;
+
+		[[nodiscard]] const auto& getExtractedPath() const { return extractedPath; }
+
+	private:
+		struct Stamp
+		{
+			uintmax_t size = 0;
+			long long modified = 0;
+			std::string hash;
+		};
+
+		[[nodiscard]] std::optional<Stamp> statArchive() const;
+		[[nodiscard]] std::string hashArchive() const;
+		[[nodiscard]] static std::optional<Stamp> readStamp(const std::string& folder);
+		static bool writeStamp(const std::string& folder, const Stamp& stamp);
+
+		std::string archivePath;
+		std::string extractedPath;
+	};
+}
+
+#endif // MOD_EXTRACTION_CACHE_H
@@ -1,9 +1,12 @@
 #include "Mods.h"
 #include "Mod.h"
+#include "ModExtractionCache.h"
 #include "../../Configuration.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -12,11 +15,12 @@
 
 namespace fs = std::filesystem;
 
-EU4::Mods::Mods(const std::vector<std::string>& usedMods, Configuration& theConfiguration)
+EU4::Mods::Mods(const std::vector<std::string>& usedMods, Configuration& theConfiguration): descriptorIndex("mods/descriptor_index.txt")
 {
 	loadEU4ModDirectory(theConfiguration);
 	loadSteamWorkshopDirectory(theConfiguration);
 	loadCK2ExportDirectory(theConfiguration);
+	descriptorIndex.save();
 	
 	Log(LogLevel::Info) << "\tFinding Used Mods";
 	for (const auto& usedMod: usedMods)
@@ -57,22 +61,23 @@ void EU4::Mods::loadSteamWorkshopDirectory(const Configuration& theConfiguration
 	LOG(LogLevel::Info) << "\tSteam Workshop directory is " << steamWorkshopPath;
 	std::set<std::string> subfolders;
 	Utils::GetAllSubfolders(steamWorkshopPath, subfolders);
+	std::vector<std::string> descriptorFilenames;
 	for (const auto& subfolder: subfolders)
 	{
-		const auto path = steamWorkshopPath + "/" + subfolder;
-		const auto descriptorFilename = path + "/descriptor.mod";
-		if (Utils::doesFolderExist(path) && Utils::DoesFileExist(descriptorFilename))
-		{
-			std::ifstream modFile(fs::u8path(path + "/descriptor.mod"));
-			Mod theMod(modFile);
-			modFile.close();
+		descriptorFilenames.push_back(steamWorkshopPath + "/" + subfolder + "/descriptor.mod");
+	}
 
-			if (theMod.isValid())
-			{
-				possibleMods.insert(std::make_pair("mod/ugc_" + subfolder + ".mod", path));
-				possibleMods.insert(std::make_pair(theMod.getName(), path));
-				Log(LogLevel::Info) << "\t\tFound potential mod named " << theMod.getName() << " at " << path;
-			}
+	const auto descriptors = descriptorIndex.read(descriptorFilenames);
+	auto descriptor = descriptors.begin();
+	for (const auto& subfolder: subfolders)
+	{
+		const auto& theMod = *descriptor++;
+		if (theMod && theMod->isValid())
+		{
+			const auto path = steamWorkshopPath + "/" + subfolder;
+			possibleMods.insert(std::make_pair("mod/ugc_" + subfolder + ".mod", path));
+			possibleMods.insert(std::make_pair(theMod->getName(), path));
+			Log(LogLevel::Info) << "\t\tFound potential mod named " << theMod->getName() << " at " << path;
 		}
 	}
 }
@@ -96,78 +101,88 @@ void EU4::Mods::loadCK2ExportDirectory(const Configuration& theConfiguration)
 
 void EU4::Mods::loadModDirectory(const std::string& searchDirectory)
 {
-	std::set<std::string> filenames;
-	Utils::GetAllFilesInFolder(searchDirectory + "/mod", filenames);
-	for (const auto& filename: filenames)
+	std::set<std::string> allFilenames;
+	Utils::GetAllFilesInFolder(searchDirectory + "/mod", allFilenames);
+	std::vector<std::string> filenames;
+	std::vector<std::string> descriptorFilenames;
+	for (const auto& filename: allFilenames)
 	{
 		const auto pos = filename.find_last_of('.');
 		if (pos != std::string::npos && filename.substr(pos, filename.length()) == ".mod")
 		{
-			try
-			{
-				std::ifstream modFile(fs::u8path(searchDirectory + "/mod/" + filename));
-				Mod theMod(modFile);
-				modFile.close();
+			filenames.push_back(filename);
+			descriptorFilenames.push_back(searchDirectory + "/mod/" + filename);
+		}
+	}
+
+	const auto descriptors = descriptorIndex.read(descriptorFilenames);
+	for (size_t index = 0; index < filenames.size(); ++index)
+	{
+		const auto& filename = filenames[index];
+		const auto pos = filename.find_last_of('.');
+		try
+		{
+			if (!descriptors[index]) throw std::invalid_argument("");
+			const auto& theMod = *descriptors[index];
 
-				if (theMod.isValid())
+			if (theMod.isValid())
+			{
+				if (!theMod.isCompressed())
 				{
-					if (!theMod.isCompressed())
-					{
-						const auto trimmedFilename = filename.substr(0, pos);
+					const auto trimmedFilename = filename.substr(0, pos);
 
-						std::string recordDirectory;
-						if (Utils::doesFolderExist(theMod.getPath()))
-						{
-							recordDirectory = theMod.getPath();
-						}
-						else if (Utils::doesFolderExist(searchDirectory + "/" + theMod.getPath()))
-						{
-							recordDirectory = searchDirectory + "/" + theMod.getPath();
-						}
-						else
-						{
-							throw std::invalid_argument("");
-						}
+					std::string recordDirectory;
+					if (Utils::doesFolderExist(theMod.getPath()))
+					{
+						recordDirectory = theMod.getPath();
+					}
+					else if (Utils::doesFolderExist(searchDirectory + "/" + theMod.getPath()))
+					{
+						recordDirectory = searchDirectory + "/" + theMod.getPath();
+					}
+					else
+					{
+						throw std::invalid_argument("");
+					}
 
-						possibleMods.insert(std::make_pair(theMod.getName(), recordDirectory));
-						possibleMods.insert(std::make_pair("mod/" + filename, recordDirectory));
-						possibleMods.insert(std::make_pair(trimmedFilename, recordDirectory));
-						Log(LogLevel::Info) << "\t\tFound potential mod named " << theMod.getName() <<
-							" with a mod file at " << searchDirectory << "/mod/" + filename <<
-							" and itself at " << recordDirectory;
+					possibleMods.insert(std::make_pair(theMod.getName(), recordDirectory));
+					possibleMods.insert(std::make_pair("mod/" + filename, recordDirectory));
+					possibleMods.insert(std::make_pair(trimmedFilename, recordDirectory));
+					Log(LogLevel::Info) << "\t\tFound potential mod named " << theMod.getName() <<
+						" with a mod file at " << searchDirectory << "/mod/" + filename <<
+						" and itself at " << recordDirectory;
+				}
+				else
+				{
+					std::string recordDirectory;
+					if (Utils::DoesFileExist(theMod.getPath()))
+					{
+						recordDirectory = theMod.getPath();
+					}
+					else if (Utils::DoesFileExist(searchDirectory + "/" + theMod.getPath()))
+					{
+						recordDirectory = searchDirectory + "/" + theMod.getPath();
 					}
 					else
 					{
-						std::string recordDirectory;
-						if (Utils::DoesFileExist(theMod.getPath()))
-						{
-							recordDirectory = theMod.getPath();
-						}
-						else if (Utils::DoesFileExist(searchDirectory + "/" + theMod.getPath()))
-						{
-							recordDirectory = searchDirectory + "/" + theMod.getPath();
-						}
-						else
-						{
-							throw std::invalid_argument("");
-						}
+						throw std::invalid_argument("");
+					}
 
-						const auto trimmedFilename = filename.substr(0, pos);
+					const auto trimmedFilename = filename.substr(0, pos);
 
-						possibleCompressedMods.insert(std::make_pair(theMod.getName(), recordDirectory));
-						possibleCompressedMods.insert(std::make_pair("mod/" + filename, recordDirectory));
-						possibleCompressedMods.insert(std::make_pair(trimmedFilename, recordDirectory));
-						Log(LogLevel::Info) << "\t\tFound a compessed mod named " << theMod.getName() <<
-							" with a mod file at " << searchDirectory << "/mod/" + filename <<
-							" and itself at " << recordDirectory;
-					}
+					possibleCompressedMods.insert(std::make_pair(theMod.getName(), recordDirectory));
+					possibleCompressedMods.insert(std::make_pair("mod/" + filename, recordDirectory));
+					possibleCompressedMods.insert(std::make_pair(trimmedFilename, recordDirectory));
+					Log(LogLevel::Info) << "\t\tFound a compessed mod named " << theMod.getName() <<
+						" with a mod file at " << searchDirectory << "/mod/" + filename <<
+						" and itself at " << recordDirectory;
 				}
 			}
-			catch (std::exception&)
-			{
-				LOG(LogLevel::Warning) << "Error while reading " << searchDirectory << "/mod/" << filename << ". " \
-					"Mod will not be useable for conversions.";
-			}
+		}
+		catch (std::exception&)
+		{
+			LOG(LogLevel::Warning) << "Error while reading " << searchDirectory << "/mod/" << filename << ". " \
+				"Mod will not be useable for conversions.";
 		}
 	}
 }
@@ -197,12 +212,19 @@ std::optional<std::string> EU4::Mods::getModPath(const std::string& modName) con
 			uncompressedName = uncompressedName.substr(pos + 1, uncompressedName.size());
 		}
 
-		if (!Utils::doesFolderExist("mods/")) fs::create_directory("mods/");		
+		if (!Utils::doesFolderExist("mods/")) fs::create_directory("mods/");
 
-		if (!Utils::doesFolderExist("mods/" + uncompressedName))
+		const ModExtractionCache extraction(archivePath, "mods/" + uncompressedName);
+		if (!extraction.isUpToDate())
 		{
-			LOG(LogLevel::Info) << "\t\tUncompressing: " << archivePath;			
-			if (!extractZip(archivePath, "mods/" + uncompressedName))
+			LOG(LogLevel::Info) << "\t\tUncompressing: " << archivePath;
+			const auto extracted = extraction.refresh([this](const std::string& archive, const std::string& path) { return extractZip(archive, path); });
+			if (!extracted && Utils::doesFolderExist(extraction.getExtractedPath()))
+			{
+				// Possibly uncompressed by hand, as we ask for below.
+				LOG(LogLevel::Warning) << "Could not uncompress " << archivePath << ", using the existing " << extraction.getExtractedPath();
+			}
+			else if (!extracted)
 			{
 				LOG(LogLevel::Warning) << "We have trouble automatically uncompressing your mod.";
 				LOG(LogLevel::Warning) << "Please, manually uncompress: " << archivePath;
@@ -211,12 +233,7 @@ std::optional<std::string> EU4::Mods::getModPath(const std::string& modName) con
 				return std::nullopt;
 			}
 		}
-
-		if (Utils::doesFolderExist("mods/" + uncompressedName))
-		{
-			return "mods/" + uncompressedName;
-		}
-
+		return extraction.getExtractedPath();
 	}
 
 	return std::nullopt;
@@ -224,38 +241,27 @@ std::optional<std::string> EU4::Mods::getModPath(const std::string& modName) con
 
 bool EU4::Mods::extractZip(const std::string& archive, const std::string& path) const
 {
-	fs::create_directory(path);
+	// The archive is opened once and every entry inflated from it, rather than reopening it and
+	// rereading its central directory for each file.
 	auto modfile = ZipFile::Open(archive);
 	if (!modfile) return false;
+	fs::create_directories(fs::u8path(path));
 	for (size_t entryNum = 0; entryNum < modfile->GetEntriesCount(); ++entryNum)
 	{
 		const auto& entry = modfile->GetEntry(entryNum);
-		const auto& inpath = entry->GetFullName();
-		const auto& name = entry->GetName();
 		if (entry->IsDirectory()) continue;
+		const auto& inpath = entry->GetFullName();
+		if (inpath.find("..") != std::string::npos) continue; // never write outside the target
 
-		// Does target directory exist?
-		const auto dirnamepos = inpath.find(name);
-		const auto dirname = path + "/" + inpath.substr(0, dirnamepos);
-		if (!exists(fs::u8path(dirname)))
-		{
-			// we need to craft our way through to target directory.
-			auto remainder = inpath;
-			auto currentpath = path;
-			while (remainder != name)
-			{
-				const auto pos = remainder.find_first_of('/');
-				if (pos != std::string::npos)
-				{
-					auto makedirname = remainder.substr(0, pos);
-					currentpath += "/" + makedirname;
-					create_directory(fs::u8path(currentpath));
-					remainder = remainder.substr(pos + 1, remainder.length());
-				}
-				else break;
-			}
-		}
-		ZipFile::ExtractFile(archive, inpath, path + "/" + inpath);
+		const auto target = fs::u8path(path + "/" + inpath);
+		fs::create_directories(target.parent_path());
+
+		auto* decompressionStream = entry->GetDecompressionStream();
+		if (!decompressionStream) return false;
+		std::ofstream output(target, std::ios::binary);
+		std::copy(std::istreambuf_iterator<char>(*decompressionStream), std::istreambuf_iterator<char>(), std::ostreambuf_iterator<char>(output));
+		entry->CloseDecompressionStream();
+		if (!output) return false;
 	}
 	return true;
-}
\ No newline at end of file
+}
@@ -2,6 +2,7 @@
 #define EU4_MODS_H
 
 #include "../../Configuration.h"
+#include "ModDescriptorIndex.h"
 #include <map>
 #include <optional>
 
@@ -24,6 +25,7 @@ namespace EU4
 
 		std::map<std::string, std::string> possibleMods;
 		std::map<std::string, std::string> possibleCompressedMods;
+		ModDescriptorIndex descriptorIndex;
 	};
 }
 
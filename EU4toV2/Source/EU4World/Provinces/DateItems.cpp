@@ -1,5 +1,6 @@
 #include "DateItems.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::DateItems::DateItems(std::istream& theStream)
 {
@@ -8,7 +9,7 @@ EU4::DateItems::DateItems(std::istream& theStream)
 			const commonItems::singleString changeStr(theStream);
 			dateChanges.emplace_back(std::make_pair(DateItemNames[changeType], changeStr.getString()));
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
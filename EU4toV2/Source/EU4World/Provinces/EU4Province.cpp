@@ -3,6 +3,7 @@
 #include "../Country/EU4Country.h"
 #include "Log.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 #include "../../Configuration.h"
 #include <algorithm>
 #include <fstream>
@@ -11,132 +12,133 @@
 
 const double BUILDING_COST_TO_WEIGHT_RATIO = 0.02;
 
-EU4::Province::Province(const std::string& numString, std::istream& theStream)
+void EU4::Province::registerKeywords(helpers::KeywordTable<Province>& keywords)
 {
-	registerKeyword("name", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("name", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleString nameString(theStream);
-			name = nameString.getString();
+			province.name = nameString.getString();
 		});
-	registerKeyword("culture", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("culture", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleString cultureString(theStream);
-			culture = cultureString.getString();
+			province.culture = helpers::Symbol(cultureString.getString());
 		});
-	registerKeyword("religion", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("religion", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleString religionString(theStream);
-			religion = religionString.getString();
+			province.religion = helpers::Symbol(religionString.getString());
 		});
-	registerKeyword("base_tax", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("base_tax", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleDouble baseTaxDouble(theStream);
-			baseTax = baseTaxDouble.getDouble();
+			province.baseTax = baseTaxDouble.getDouble();
 		});
-	registerKeyword("base_production", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("base_production", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleDouble baseProductionDouble(theStream);
-			baseProduction = baseProductionDouble.getDouble();
+			province.baseProduction = baseProductionDouble.getDouble();
 		});
-	registerKeyword("base_manpower", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("base_manpower", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleDouble manpowerDouble(theStream);
-			manpower = manpowerDouble.getDouble();
+			province.manpower = manpowerDouble.getDouble();
 		});
-	registerKeyword("manpower", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("manpower", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleDouble manpowerDouble(theStream);
-			manpower = manpowerDouble.getDouble();
+			province.manpower = manpowerDouble.getDouble();
 		});
-	registerKeyword("owner", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("owner", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleString ownerStringString(theStream);
-			ownerString = ownerStringString.getString();
+			province.owner = helpers::Symbol(ownerStringString.getString());
 		});
-	registerKeyword("controller", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("controller", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleString controllerStringString(theStream);
-			controllerString = controllerStringString.getString();
+			province.controller = helpers::Symbol(controllerStringString.getString());
 		});
-	registerKeyword("cores", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("cores", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::stringList coresStrings(theStream);
-			for (const auto& coreString : coresStrings.getStrings()) cores.insert(coreString);
+			for (const auto& coreString : coresStrings.getStrings()) province.cores.insert(helpers::Symbol(coreString));
 		});
-	registerKeyword("core", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("core", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleString coresString(theStream);
-			cores.insert(coresString.getString());
+			province.cores.insert(helpers::Symbol(coresString.getString()));
 		});
-    registerKeyword("territorial_core", [this](const std::string& unused, std::istream& theStream) 
+    keywords.registerKeyword("territorial_core", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
-			commonItems::ignoreItem(unused, theStream);
-			territorialCore = true;
+			helpers::ignoreItem(unused, theStream);
+			province.territorialCore = true;
 		 });
-	registerKeyword("hre", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("hre", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleString hreStr(theStream);
-			inHRE = hreStr.getString() == "yes";
+			province.inHRE = hreStr.getString() == "yes";
 		});
-	registerKeyword("is_city", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("is_city", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleString cityStr(theStream);
-			city = cityStr.getString() == "yes";
+			province.city = cityStr.getString() == "yes";
 		});
-	registerKeyword("colonysize", [this](const std::string & unused, std::istream & theStream) 
+	keywords.registerKeyword("colonysize", [](Province& province, const std::string & unused, std::istream & theStream) 
 		{
-			commonItems::ignoreItem(unused, theStream);
-			colony = true;
+			helpers::ignoreItem(unused, theStream);
+			province.colony = true;
 	});
-	registerKeyword("original_coloniser", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("original_coloniser", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
-			commonItems::ignoreItem(unused, theStream);
-			hadOriginalColoniser = true;
+			helpers::ignoreItem(unused, theStream);
+			province.hadOriginalColoniser = true;
 		});
-	registerKeyword("history", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("history", [](Province& province, const std::string& unused, std::istream& theStream)
 		{
-			const ProvinceHistory theHistory(theStream);
-			provinceHistory = theHistory;
+			province.provinceHistory = ProvinceHistory(theStream);
 		});
-	registerKeyword("buildings", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("buildings", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const ProvinceBuildings theBuildings(theStream);
-			buildings = theBuildings;
+			province.buildings = theBuildings;
 		});
-	registerKeyword("great_projects", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("great_projects", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::stringList theProjects(theStream);
-			for (const auto& project : theProjects.getStrings()) greatProjects.insert(project);
+			for (const auto& project : theProjects.getStrings()) province.greatProjects.insert(project);
 		});
-	registerKeyword("modifier", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("modifier", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const ProvinceModifier modifier(theStream);
-			modifiers.insert(modifier.getModifier());
+			province.modifiers.insert(modifier.getModifier());
 		});
-	registerKeyword("trade_goods", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("trade_goods", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleString tradeGoodsString(theStream);
-			tradeGoods = tradeGoodsString.getString();
+			province.tradeGoods = helpers::Symbol(tradeGoodsString.getString());
 		});
-	registerKeyword("center_of_trade", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("center_of_trade", [](Province& province, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleInt cotLevelInt(theStream);
-			centerOfTradeLevel = cotLevelInt.getInt();
+			province.centerOfTradeLevel = cotLevelInt.getInt();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	keywords.registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
+}
 
-	parseStream(theStream);
-	clearRegisteredKeywords();
+EU4::Province::Province(const std::string& numString, std::istream& theStream)
+{
+	thread_local helpers::KeywordTable<Province> keywords(registerKeywords);
+	keywords.parse(*this, theStream);
 
 	num = 0 - stoi(numString);
 
 	if (!provinceHistory.hasInitializedHistory() && !culture.empty() && !religion.empty())
 	{
 		// recover from broken save data.
-		provinceHistory.setStartingCulture(culture);
-		provinceHistory.setStartingReligion(religion);
+		provinceHistory.setStartingCulture(culture.getString());
+		provinceHistory.setStartingReligion(religion.getString());
 	} // Else it's probably a blank province anyway.
-	
 
 	// for old versions of EU4 (< 1.12), copy tax to production if necessary
 	if (baseProduction == 0 && baseTax > 0)
@@ -225,7 +227,7 @@ void EU4::Province::determineProvinceWeight(const mappers::Buildings& buildingTy
 		modifierWeight = (std::log10(modifierWeight) - 1) * 10;
 	}
 
-	if (ownerString.empty())
+	if (owner.empty())
 	{
 		totalWeight = 0;
 		modifierWeight = 0;
@@ -9,21 +9,22 @@
 #include "ProvinceStats.h"
 #include "../../Mappers/Buildings/Buildings.h"
 #include "../Modifiers/Modifiers.h"
-#include "newParser.h"
+#include "../../Helpers/KeywordTable.h"
+#include "../../Helpers/Symbols.h"
 #include "../../Mappers/SuperGroupMapper/SuperGroupMapper.h"
 #include "../Regions/Regions.h"
 
 namespace EU4
 {
-	class Province: commonItems::parser
+	class Province
 	{
 	public:
 		Province(const std::string& numString, std::istream& theStream);
 
-		void addCore(const std::string& tag) { cores.insert(tag); }
-		void removeCore(const std::string& tag) { cores.erase(tag); }
-		void setOwnerString(const std::string& _owner) { ownerString = _owner; }
-		void setControllerString(const std::string& _controller) { controllerString = _controller; }
+		void addCore(const std::string& tag) { cores.insert(helpers::Symbol(tag)); }
+		void removeCore(const std::string& tag) { cores.erase(helpers::Symbol(tag)); }
+		void setOwnerString(const std::string& _owner) { owner = helpers::Symbol(_owner); }
+		void setControllerString(const std::string& _controller) { controller = helpers::Symbol(_controller); }
 		void setTradeGoodPrice(double price) { tradeGoodsPrice = price; }
 		void setArea(const std::string& a) { areaName = a; }
 		void updatePopRatioCulture(const std::string& oldCultureName, const std::string& neoCultureName, const std::string& superRegion)
@@ -32,8 +33,12 @@ namespace EU4
 
 		[[nodiscard]] const auto& getArea() const { return areaName; }
 		[[nodiscard]] const auto& getName() const { return name; }
-		[[nodiscard]] const auto& getOwnerString() const { return ownerString; }
-		[[nodiscard]] const auto& getControllerString() const { return controllerString; }
+		[[nodiscard]] const auto& getOwnerString() const { return owner.getString(); }
+		[[nodiscard]] const auto& getControllerString() const { return controller.getString(); }
+		[[nodiscard]] auto getOwnerSymbol() const { return owner; }
+		[[nodiscard]] auto getControllerSymbol() const { return controller; }
+		[[nodiscard]] auto getCultureSymbol() const { return culture; }
+		[[nodiscard]] auto getReligionSymbol() const { return religion; }
 		[[nodiscard]] const auto& getOriginalCulture() const { return provinceHistory.getOriginalCulture(); }
 		[[nodiscard]] auto getNum() const { return num; }
 		[[nodiscard]] auto inHre() const { return inHRE; }
@@ -52,7 +57,8 @@ namespace EU4
 		[[nodiscard]] auto getTotalDevModifier() const { return devModifier; }
 		[[nodiscard]] auto getDevDelta() const { return devDelta; }
 		[[nodiscard]] auto getModifierWeight() const { return modifierWeight; }
-		[[nodiscard]] const auto& getTradeGoods() const { return tradeGoods; }
+		[[nodiscard]] const auto& getTradeGoods() const { return tradeGoods.getString(); }
+		[[nodiscard]] auto getTradeGoodsSymbol() const { return tradeGoods; }
 		[[nodiscard]] auto getProsperity() const { return prosperity; }
 
 		[[nodiscard]] const auto& getProvinceStats() const { return provinceStats; }
@@ -68,16 +74,17 @@ namespace EU4
 		void determineProvinceWeight(const mappers::Buildings& buildingTypes, const Modifiers& modifierTypes);
 
 	private:
+		static void registerKeywords(helpers::KeywordTable<Province>& keywords);
 		[[nodiscard]] BuildingWeightEffects getProvBuildingWeight(const mappers::Buildings& buildingTypes, const Modifiers& modifierTypes) const;
 
 		int num = 0;
 		std::string name;
-		std::string ownerString;
-		std::string controllerString;
-		std::string culture;
-		std::string religion;
+		helpers::Symbol owner;
+		helpers::Symbol controller;
+		helpers::Symbol culture;
+		helpers::Symbol religion;
 
-		std::set<std::string> cores;
+		std::set<helpers::Symbol> cores;
 
 		bool inHRE = false;
 		bool colony = false;
@@ -95,7 +102,7 @@ namespace EU4
 		double baseProduction = 0;
 		double manpower = 0;
 		double totalWeight = 0;
-		std::string tradeGoods;
+		helpers::Symbol tradeGoods;
 		double tradeGoodsPrice = 0;
 		std::string areaName;
 		double taxIncome = 0;
@@ -1,13 +1,14 @@
 #include "ProvinceBuildings.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::ProvinceBuildings::ProvinceBuildings(std::istream& theStream)
 {
 	registerRegex("[a-zA-Z0-9_]+", [this](const std::string& building, std::istream& theStream) {
-		commonItems::ignoreItem(building, theStream);
+		helpers::ignoreItem(building, theStream);
 		buildings.insert(building);
 	});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
@@ -3,55 +3,68 @@
 #include "../../Configuration.h"
 #include "Log.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/DayNumbers.h"
+#include "../../Helpers/RawBlocks.h"
 
-EU4::ProvinceHistory::ProvinceHistory(std::istream& theStream)
+void EU4::ProvinceHistory::registerKeywords(helpers::KeywordTable<ProvinceHistory>& keywords)
 {
-	registerKeyword("owner", [this](const std::string& unused, std::istream & theStream) {
+	keywords.registerKeyword("owner", [](ProvinceHistory& history, const std::string& unused, std::istream & theStream) {
 		const commonItems::singleString ownerString(theStream);
-		ownershipHistory.emplace_back(std::make_pair(theConfiguration.getStartEU4Date(), ownerString.getString()));
+		history.ownershipHistory.emplace_back(std::make_pair(helpers::toDayNumber(theConfiguration.getStartEU4Date()), ownerString.getString()));
 	});
-	registerKeyword("culture", [this](const std::string& unused, std::istream & theStream) {
+	keywords.registerKeyword("culture", [](ProvinceHistory& history, const std::string& unused, std::istream & theStream) {
 		const commonItems::singleString cultureString(theStream);
-		startingCulture = cultureString.getString();
+		history.startingCulture = cultureString.getString();
 	});
-	registerKeyword("religion", [this](const std::string& unused, std::istream & theStream) {
+	keywords.registerKeyword("religion", [](ProvinceHistory& history, const std::string& unused, std::istream & theStream) {
 		const commonItems::singleString religionString(theStream);
-		startingReligion = religionString.getString();
+		history.startingReligion = religionString.getString();
 	});
-	registerKeyword("base_tax", [this](const std::string& unused, std::istream& theStream) {
+	keywords.registerKeyword("base_tax", [](ProvinceHistory& history, const std::string& unused, std::istream& theStream) {
 		const commonItems::singleDouble baseTaxDouble(theStream);
-		originalTax = baseTaxDouble.getDouble();
+		history.originalTax = baseTaxDouble.getDouble();
 	});
-	registerKeyword("base_production", [this](const std::string& unused, std::istream& theStream) {
+	keywords.registerKeyword("base_production", [](ProvinceHistory& history, const std::string& unused, std::istream& theStream) {
 		const commonItems::singleDouble baseProductionDouble(theStream);
-		originalProduction = baseProductionDouble.getDouble();
+		history.originalProduction = baseProductionDouble.getDouble();
 	});
-	registerKeyword("base_manpower", [this](const std::string& unused, std::istream& theStream) {
+	keywords.registerKeyword("base_manpower", [](ProvinceHistory& history, const std::string& unused, std::istream& theStream) {
 		const commonItems::singleDouble manpowerDouble(theStream);
-		originalManpower = manpowerDouble.getDouble();
+		history.originalManpower = manpowerDouble.getDouble();
 	});
-	registerRegex("\\d+\\.\\d+\\.\\d+", [this](const std::string& dateString, std::istream& theStream) {
-		auto theDate = date(dateString);
+	keywords.registerRegex("[a-zA-Z0-9_\\.:]+", [](ProvinceHistory& history, const std::string& key, std::istream& theStream) {
+		// Dated entries make up most of the block, so they are recognized by scanning the key
+		// rather than by trying a second regex on every one of them.
+		const auto dayNumber = helpers::parseDayNumber(key);
+		if (!dayNumber)
+		{
+			helpers::skipValue(theStream);
+			return;
+		}
 		const DateItems theItems(theStream);
-		for (const auto& theItem : theItems.getDateChanges())
+		for (const auto& theItem: theItems.getDateChanges())
 		{
 			switch (theItem.first) {
 			case DateItemType::OWNER_CHANGE:
-				ownershipHistory.emplace_back(std::make_pair(theDate, theItem.second));
+				history.ownershipHistory.emplace_back(std::make_pair(*dayNumber, theItem.second));
 				break;
 			case DateItemType::CULTURE_CHANGE:
-				cultureHistory.emplace_back(std::make_pair(theDate, theItem.second));
+				history.cultureHistory.emplace_back(std::make_pair(*dayNumber, theItem.second));
 				break;
 			case DateItemType::RELIGION_CHANGE:
-				religionHistory.emplace_back(std::make_pair(theDate, theItem.second));
+				history.religionHistory.emplace_back(std::make_pair(*dayNumber, theItem.second));
 				break;
 			}
 		}
 	});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+}
+
+EU4::ProvinceHistory::ProvinceHistory(std::istream& theStream)
+{
+	thread_local helpers::KeywordTable<ProvinceHistory> keywords(registerKeywords);
+	keywords.parse(*this, theStream);
 
-	parseStream(theStream);
-	clearRegisteredKeywords();
+	const auto startDay = helpers::toDayNumber(theConfiguration.getStartEU4Date());
 
 	if (theConfiguration.getConvertAll())
 	{
@@ -59,32 +72,32 @@ EU4::ProvinceHistory::ProvinceHistory(std::istream& theStream)
 		if (!cultureHistory.empty())
 		{
 			auto lastCulture = cultureHistory.back();
-			lastCulture.first = theConfiguration.getStartEU4Date();
+			lastCulture.first = startDay;
 			cultureHistory.clear();
 			cultureHistory.emplace_back(lastCulture);
 		}
 		if (!religionHistory.empty())
 		{
 			auto lastReligion = religionHistory.back();
-			lastReligion.first = theConfiguration.getStartEU4Date();
+			lastReligion.first = startDay;
 			religionHistory.clear();
 			religionHistory.emplace_back(lastReligion);
 		}
 	}
 
-	if (!startingCulture.empty() && (cultureHistory.empty() || cultureHistory.begin()->first != theConfiguration.getStartEU4Date()))
+	if (!startingCulture.empty() && (cultureHistory.empty() || cultureHistory.begin()->first != startDay))
 	{
-		cultureHistory.insert(cultureHistory.begin(), std::make_pair(theConfiguration.getStartEU4Date(), startingCulture));
+		cultureHistory.insert(cultureHistory.begin(), std::make_pair(startDay, startingCulture));
 	}
-	if (!startingReligion.empty() && (religionHistory.empty() || religionHistory.begin()->first != theConfiguration.getStartEU4Date()))
+	if (!startingReligion.empty() && (religionHistory.empty() || religionHistory.begin()->first != startDay))
 	{
-		religionHistory.insert(religionHistory.begin(), std::make_pair(theConfiguration.getStartEU4Date(), startingReligion));
+		religionHistory.insert(religionHistory.begin(), std::make_pair(startDay, startingReligion));
 	}
 }
 
 std::optional<date> EU4::ProvinceHistory::getFirstOwnedDate() const
 {
-	if (!ownershipHistory.empty()) return ownershipHistory[0].first;
+	if (!ownershipHistory.empty()) return helpers::toDate(ownershipHistory[0].first);
 	return std::nullopt;
 }
 
@@ -97,8 +110,8 @@ bool EU4::ProvinceHistory::hasOriginalCulture() const
 bool EU4::ProvinceHistory::wasColonized() const
 {
 	if (!ownershipHistory.empty() &&
-		ownershipHistory[0].first != theConfiguration.getStartEU4Date() &&
-		ownershipHistory[0].first != theConfiguration.getFirstEU4Date()) 
+		ownershipHistory[0].first != helpers::toDayNumber(theConfiguration.getStartEU4Date()) &&
+		ownershipHistory[0].first != helpers::toDayNumber(theConfiguration.getFirstEU4Date()))
 	{
 		return !hasOriginalCulture();
 	}
@@ -112,6 +125,8 @@ void EU4::ProvinceHistory::buildPopRatios(const double assimilationFactor)
 	
 	auto endDate = theConfiguration.getLastEU4Date();
 	if (endDate > HARD_ENDING_DATE || !endDate.isSet()) endDate = HARD_ENDING_DATE;
+	const auto endDay = helpers::toDayNumber(endDate);
+	const auto futureDay = helpers::toDayNumber(FUTURE_DATE);
 
 	std::string startingCulture;
 	auto cultureEvent = cultureHistory.begin();
@@ -130,14 +145,14 @@ void EU4::ProvinceHistory::buildPopRatios(const double assimilationFactor)
 	}
 
 	PopRatio currentRatio(startingCulture, startingReligion);
-	date cultureEventDate;
-	date religionEventDate;
-	auto lastLoopDate = theConfiguration.getStartEU4Date();
+	helpers::DayNumber cultureEventDate;
+	helpers::DayNumber religionEventDate;
+	auto lastLoopDate = helpers::toDayNumber(theConfiguration.getStartEU4Date());
 	while (cultureEvent != cultureHistory.end() || religionEvent != religionHistory.end())
 	{
 		if (cultureEvent == cultureHistory.end())
 		{
-			cultureEventDate = FUTURE_DATE;
+			cultureEventDate = futureDay;
 		}
 		else
 		{
@@ -146,7 +161,7 @@ void EU4::ProvinceHistory::buildPopRatios(const double assimilationFactor)
 
 		if (religionEvent == religionHistory.end())
 		{
-			religionEventDate = FUTURE_DATE;
+			religionEventDate = futureDay;
 		}
 		else
 		{
@@ -192,7 +207,7 @@ void EU4::ProvinceHistory::buildPopRatios(const double assimilationFactor)
 			++religionEvent;
 		}
 	}
-	decayPopRatios(lastLoopDate, endDate, currentRatio, assimilationFactor);
+	decayPopRatios(lastLoopDate, endDay, currentRatio, assimilationFactor);
 
 	if (!currentRatio.getCulture().empty() || !currentRatio.getReligion().empty())
 	{
@@ -200,12 +215,12 @@ void EU4::ProvinceHistory::buildPopRatios(const double assimilationFactor)
 	}
 }
 
-void EU4::ProvinceHistory::decayPopRatios(const date& oldDate, const date& newDate, PopRatio& currentPop, const double assimilationFactor)
+void EU4::ProvinceHistory::decayPopRatios(const helpers::DayNumber oldDate, const helpers::DayNumber newDate, PopRatio& currentPop, const double assimilationFactor)
 {
 	// no decay needed for initial state
-	if (oldDate == theConfiguration.getStartEU4Date()) return;
+	if (oldDate == helpers::toDayNumber(theConfiguration.getStartEU4Date())) return;
 
-	const auto diffInYears = newDate.diffInYears(oldDate);
+	const auto diffInYears = helpers::yearsBetween(newDate, oldDate);
 	for (auto& popRatio: popRatios) popRatio.decay(diffInYears, assimilationFactor);
 
 	currentPop.increase(diffInYears, assimilationFactor);
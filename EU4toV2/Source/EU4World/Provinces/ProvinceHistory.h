@@ -3,13 +3,14 @@
 
 #include "Date.h"
 #include "PopRatio.h"
-#include "newParser.h"
+#include "../../Helpers/DayNumbers.h"
+#include "../../Helpers/KeywordTable.h"
 #include <optional>
 #include <vector>
 
 namespace EU4
 {
-	class ProvinceHistory: commonItems::parser
+	class ProvinceHistory
 	{
 	public:
 		ProvinceHistory() = default;
@@ -18,7 +19,7 @@ namespace EU4
 		void updatePopRatioCulture(const std::string& oldCultureName, const std::string& neoCultureName, const std::string& superRegion);
 		void buildPopRatios(double assimilationFactor);
 		void setStartingCulture(const std::string& culture) { startingCulture = culture; }
-		void setStartingReligion(const std::string& religion) { startingCulture = religion; }
+		void setStartingReligion(const std::string& religion) { startingReligion = religion; }
 
 		[[nodiscard]] std::optional<date> getFirstOwnedDate() const;
 		[[nodiscard]] bool hasOriginalCulture() const;
@@ -30,14 +31,15 @@ namespace EU4
 		[[nodiscard]] const auto& getPopRatios() const { return popRatios; }
 		
 	private:
-		void decayPopRatios(const date& oldDate, const date& newDate, PopRatio& currentPop, double assimilationFactor);
+		static void registerKeywords(helpers::KeywordTable<ProvinceHistory>& keywords);
+		void decayPopRatios(helpers::DayNumber oldDate, helpers::DayNumber newDate, PopRatio& currentPop, double assimilationFactor);
 
 		std::string startingCulture;
 		std::string startingReligion;
 
-		std::vector<std::pair<date, std::string>> ownershipHistory;
-		std::vector<std::pair<date, std::string>> religionHistory;
-		std::vector<std::pair<date, std::string>> cultureHistory;
+		std::vector<std::pair<helpers::DayNumber, std::string>> ownershipHistory;
+		std::vector<std::pair<helpers::DayNumber, std::string>> religionHistory;
+		std::vector<std::pair<helpers::DayNumber, std::string>> cultureHistory;
 
 		std::vector<PopRatio> popRatios;
 		double originalTax = 0;
@@ -1,5 +1,6 @@
 #include "ProvinceModifier.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::ProvinceModifier::ProvinceModifier(std::istream& theStream)
 {
@@ -7,7 +8,7 @@ EU4::ProvinceModifier::ProvinceModifier(std::istream& theStream)
 		const commonItems::singleString modifierString(theStream);
 		modifier = modifierString.getString();
 	});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
@@ -1,19 +1,31 @@
 #include "Log.h"
 #include "Provinces.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
+#include "../../Helpers/ThreadPool.h"
+#include "../../Helpers/ViewStream.h"
 #include <fstream>
 
 EU4::Provinces::Provinces(std::istream& theStream)
 {
-	registerRegex("-[0-9]+", [this](const std::string& numberString, std::istream& theStream)
+	// Province blocks don't depend on each other, so they are only cut out here and built in parallel below.
+	std::vector<std::pair<std::string, helpers::RawBlock>> provinceBlocks;
+	registerRegex("-[0-9]+", [&provinceBlocks](const std::string& numberString, std::istream& theStream)
 	{
-		auto newProvince = std::make_shared<Province>(numberString, theStream);
-		provinces.insert(std::make_pair(newProvince->getNum(), std::move(newProvince)));
+		provinceBlocks.emplace_back(numberString, helpers::captureValue(theStream));
 	});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
+
+	std::vector<std::shared_ptr<Province>> builtProvinces(provinceBlocks.size());
+	helpers::ThreadPool::shared().parallelFor(provinceBlocks.size(), [&provinceBlocks, &builtProvinces](const size_t index)
+	{
+		helpers::ViewStream blockStream(provinceBlocks[index].second.getText());
+		builtProvinces[index] = std::make_shared<Province>(provinceBlocks[index].first, blockStream);
+	});
+	for (auto& newProvince: builtProvinces) provinces.insert(std::make_pair(newProvince->getNum(), std::move(newProvince)));
 }
 
 std::shared_ptr<EU4::Province> EU4::Provinces::getProvince(const int provinceNumber)
@@ -1,5 +1,6 @@
 #include "EU4Empire.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::EU4Empire::EU4Empire(std::istream& theStream)
 {
@@ -8,7 +9,7 @@ EU4::EU4Empire::EU4Empire(std::istream& theStream)
 			const commonItems::singleString emperorStr(theStream);
 			emperor = emperorStr.getString();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
@@ -1,5 +1,6 @@
 #include "EU4RelationDetails.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::EU4RelationDetails::EU4RelationDetails(std::istream& theStream)
 {
@@ -11,7 +12,7 @@ EU4::EU4RelationDetails::EU4RelationDetails(std::istream& theStream)
 		});
 	registerKeyword("military_access", [this](const std::string& unused, std::istream& theStream)
 		{
-			commonItems::ignoreItem(unused, theStream);
+			helpers::ignoreItem(unused, theStream);
 			military_access = true;
 		});
 	registerKeyword("last_send_diplomat", [this](const std::string& unused, std::istream& theStream)
@@ -29,7 +30,7 @@ EU4::EU4RelationDetails::EU4RelationDetails(std::istream& theStream)
 			const commonItems::singleString attitudeStr(theStream);
 			attitude = attitudeStr.getString();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
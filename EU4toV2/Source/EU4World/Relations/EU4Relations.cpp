@@ -1,5 +1,6 @@
 #include "EU4Relations.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::EU4Relations::EU4Relations(std::istream& theStream)
 {
@@ -8,7 +9,7 @@ EU4::EU4Relations::EU4Relations(std::istream& theStream)
 			const EU4RelationDetails newDetails(theStream);
 			relations.insert(std::make_pair(tag, newDetails));
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
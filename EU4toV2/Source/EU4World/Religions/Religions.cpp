@@ -2,7 +2,6 @@
 #include "ReligionGroup.h"
 #include "ParserHelpers.h"
 #include "../../Configuration.h"
-#include "OSCompatibilityLayer.h"
 #include "Log.h"
 
 EU4::Religions::Religions()
@@ -11,20 +10,9 @@ EU4::Religions::Religions()
 
 	registerKeys();
 
-	std::set<std::string> filenames;
-	Utils::GetAllFilesInFolder(theConfiguration.getEU4Path() + "/common/religions/", filenames);
-	for (const auto& filename : filenames)
+	for (const auto& filename : theConfiguration.getEU4Files().list("common/religions"))
 	{
-		parseFile(theConfiguration.getEU4Path() + "/common/religions/" + filename);
-	}
-	for (const auto& modName : theConfiguration.getEU4Mods())
-	{
-		std::set<std::string> moreFilenames;
-		Utils::GetAllFilesInFolder(modName + "/common/religions/", moreFilenames);
-		for (const auto& filename : filenames)
-		{
-			parseFile(modName + "/common/religions/" + filename);
-		}
+		parseStream(*theConfiguration.getEU4Definitions().open(filename));
 	}
 	clearRegisteredKeywords();
 }
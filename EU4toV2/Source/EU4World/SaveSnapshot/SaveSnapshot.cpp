@@ -0,0 +1,101 @@
+#include "SaveSnapshot.h"
+#include "../../Helpers/ContentHash.h"
+#include "../../Helpers/MappedFile.h"
+#include "../../Helpers/RawBlocks.h"
+#include "../../Helpers/ViewStream.h"
+#include "Log.h"
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+namespace fs = std::filesystem;
+
+namespace
+{
+	// Part of every snapshot's name, so snapshots written by an older converter are never read.
+	// Bump it whenever the set of recorded sections changes.
+	constexpr std::string_view SNAPSHOT_FORMAT = "EU4toVic2 save snapshot 1";
+	const std::string SNAPSHOT_DIRECTORY = "snapshots";
+}
+
+EU4::SaveSnapshot::SaveSnapshot(const std::string& savePath)
+{
+	const helpers::MappedFile save(savePath);
+	if (!save.isOpen()) throw std::runtime_error("Could not open " + savePath + " to look for its snapshot.");
+
+	helpers::ContentHash hash;
+	hash.update(SNAPSHOT_FORMAT).update(save.getView());
+	path = SNAPSHOT_DIRECTORY + "/" + hash.toString() + ".eu4snap";
+	// Unique, so two conversions of the same save never record into the same file.
+	temporaryPath = path + ".tmp" + std::to_string(std::random_device()());
+}
+
+EU4::SaveSnapshot::~SaveSnapshot()
+{
+	if (!recording.is_open()) return;
+	recording.close();
+	std::error_code ignored;
+	fs::remove(fs::u8path(temporaryPath), ignored);
+}
+
+bool EU4::SaveSnapshot::exists() const
+{
+	std::error_code ignored;
+	return fs::is_regular_file(fs::u8path(path), ignored);
+}
+
+void EU4::SaveSnapshot::startRecording()
+{
+	fs::create_directories(fs::u8path(SNAPSHOT_DIRECTORY));
+	recording.open(fs::u8path(temporaryPath), std::ios::binary | std::ios::trunc);
+	if (!recording.is_open())
+	{
+		LOG(LogLevel::Warning) << "Could not create " << temporaryPath << ", this save will not be snapshotted.";
+		return;
+	}
+	recording << "EU4txt\n";
+}
+
+void EU4::SaveSnapshot::record(const std::string& key, const std::string_view value)
+{
+	recording << key << '=';
+	recording.write(value.data(), static_cast<std::streamsize>(value.size()));
+	recording << '\n';
+}
+
+void EU4::SaveSnapshot::keep(const std::string& key, std::istream& theStream, const commonItems::parsingFunction& handler)
+{
+	if (!isRecording())
+	{
+		handler(key, theStream);
+		return;
+	}
+
+	const auto block = helpers::captureValue(theStream);
+	record(key, block.getText());
+	// captureValue leaves the "=" out, but handlers of single values expect to read it first.
+	const auto assignment = "= " + std::string(block.getText());
+	helpers::ViewStream blockStream(assignment);
+	handler(key, blockStream);
+}
+
+void EU4::SaveSnapshot::finishRecording()
+{
+	recording.close();
+	if (recording.fail())
+	{
+		LOG(LogLevel::Warning) << "Could not write " << temporaryPath << ", this save will not be snapshotted.";
+		std::error_code ignored;
+		fs::remove(fs::u8path(temporaryPath), ignored);
+		return;
+	}
+
+	std::error_code error;
+	fs::rename(fs::u8path(temporaryPath), fs::u8path(path), error);
+	if (error)
+	{
+		LOG(LogLevel::Warning) << "Could not store snapshot " << path << ": " << error.message();
+		fs::remove(fs::u8path(temporaryPath), error);
+		return;
+	}
+	LOG(LogLevel::Info) << "-> Stored a snapshot of this save as " << path;
+}
@@ -0,0 +1,43 @@
+#ifndef EU4_SAVE_SNAPSHOT_H
+#define EU4_SAVE_SNAPSHOT_H
+
+#include "newParser.h"
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace EU4
+{
+	// Opt-in cache of the parts of a save the converter reads, for converting the same save over
+	// and over while tuning the configuration. The first conversion records every section the
+	// world parses, as plain text with everything it ignores left out, to
+	// snapshots/<content hash>.eu4snap. Later conversions of the same save parse that file instead
+	// of unpacking and scanning the whole save. The recorded sections are still parsed as usual.
+	class SaveSnapshot
+	{
+	public:
+		explicit SaveSnapshot(const std::string& savePath);
+		~SaveSnapshot();
+		SaveSnapshot(const SaveSnapshot&) = delete;
+		SaveSnapshot& operator=(const SaveSnapshot&) = delete;
+
+		[[nodiscard]] bool exists() const;
+		[[nodiscard]] const auto& getPath() const { return path; }
+
+		// Recording goes to a temporary file, which only takes the snapshot's place once the
+		// whole save parsed. A recording that is never finished is thrown away.
+		void startRecording();
+		void record(const std::string& key, std::string_view value);
+		// Hands the value after a key to its handler, recording it first while recording.
+		void keep(const std::string& key, std::istream& theStream, const commonItems::parsingFunction& handler);
+		void finishRecording();
+		[[nodiscard]] bool isRecording() const { return recording.is_open(); }
+
+	private:
+		std::string path;
+		std::string temporaryPath;
+		std::ofstream recording;
+	};
+}
+
+#endif // EU4_SAVE_SNAPSHOT_H
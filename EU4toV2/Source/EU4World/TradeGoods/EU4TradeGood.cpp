@@ -1,5 +1,6 @@
 #include "EU4TradeGood.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::TradeGood::TradeGood(std::istream& theStream)
 {
@@ -8,7 +9,7 @@ EU4::TradeGood::TradeGood(std::istream& theStream)
 			const commonItems::singleDouble priceDbl(theStream);
 			price = priceDbl.getDouble();
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
@@ -1,5 +1,6 @@
 #include "EU4TradeGoods.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 #include "EU4TradeGood.h"
 
 EU4::TradeGoods::TradeGoods(std::istream& theStream)
@@ -10,7 +11,7 @@ EU4::TradeGoods::TradeGoods(std::istream& theStream)
 			tradeGoods.insert(std::make_pair(tradeGood, newGood.getPrice()));
 		});
 
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
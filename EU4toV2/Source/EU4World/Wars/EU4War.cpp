@@ -1,5 +1,6 @@
 #include "EU4War.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 EU4::War::War(std::istream& theStream)
 {
@@ -28,7 +29,7 @@ EU4::War::War(std::istream& theStream)
 			details.warGoalClass = warGoalClass;
 		});
 
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
@@ -1,5 +1,6 @@
 #include "EU4WarDetails.h"
 #include "ParserHelpers.h"
+#include "../../Helpers/RawBlocks.h"
 
 void EU4::WarDetails::addDetails(std::istream& theStream)
 {
@@ -26,9 +27,9 @@ void EU4::WarDetails::addDetails(std::istream& theStream)
 	registerRegex("\\d+\\.\\d+\\.\\d+", [this](const std::string& dateString, std::istream& theStream) 
 		{
 			if (startDate == date("1.1.1")) startDate = date(dateString);
-			commonItems::ignoreItem(dateString, theStream);			
+			helpers::ignoreItem(dateString, theStream);			
 		});
-	registerRegex("[a-zA-Z0-9_\\.:]+", commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_\\.:]+", helpers::ignoreItem);
 
 	parseStream(theStream);
 	clearRegisteredKeywords();
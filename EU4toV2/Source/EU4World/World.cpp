@@ -2,7 +2,7 @@
 #include "Country/Countries.h"
 #include "Country/EU4Country.h"
 #include "EU4Version.h"
-#include "Localisation/EU4Localisation.h"
+#include "SaveSnapshot/SaveSnapshot.h"
 #include "Mods/Mods.h"
 #include "Provinces/EU4Province.h"
 #include "Regions/Areas.h"
@@ -12,6 +12,9 @@
 #include "OSCompatibilityLayer.h"
 #include "ParserHelpers.h"
 #include "NationMerger/NationMergeParser.h"
+#include "../Helpers/RawBlocks.h"
+#include "../Helpers/ThreadPool.h"
+#include "../Helpers/ViewStream.h"
 #include <set>
 #include <algorithm>
 #include <exception>
@@ -20,134 +23,245 @@
 #include "Relations/EU4Empire.h"
 #include <ZipFile.h>
 #include <filesystem>
+#include <future>
 namespace fs = std::filesystem;
 
+namespace
+{
+	// Gamestate sections being parsed on worker threads. Whatever is still in flight is waited
+	// for on destruction, so a failure on the main thread never leaves a worker using a dead World.
+	struct PendingSections
+	{
+		std::future<std::unique_ptr<EU4::Provinces>> provinces;
+		std::future<std::map<std::string, std::shared_ptr<EU4::Country>>> countries;
+		std::future<std::vector<EU4::EU4Agreement>> diplomacy;
+		std::vector<std::future<EU4::War>> wars;
+
+		PendingSections() = default;
+		PendingSections(const PendingSections&) = delete;
+		PendingSections& operator=(const PendingSections&) = delete;
+		~PendingSections()
+		{
+			waitFor(provinces);
+			waitFor(countries);
+			waitFor(diplomacy);
+			for (const auto& war: wars) waitFor(war);
+		}
+
+		template <typename Result> static void waitFor(const std::future<Result>& task)
+		{
+			if (task.valid()) task.wait();
+		}
+	};
+}
+
 EU4::World::World(const mappers::IdeaEffectMapper& ideaEffectMapper)
 {
 	LOG(LogLevel::Info) << "*** Hello EU4, loading World. ***";
+
+	// While a snapshot is being recorded, the values of the handlers wrapped in kept() are
+	// written to the snapshot before they are parsed.
+	std::unique_ptr<SaveSnapshot> snapshot;
+	const auto kept = [&snapshot](const commonItems::parsingFunction& handler) -> commonItems::parsingFunction
+	{
+		return [&snapshot, handler](const std::string& key, std::istream& theStream)
+		{
+			if (snapshot) snapshot->keep(key, theStream, handler);
+			else handler(key, theStream);
+		};
+	};
+
 	registerKeyword("EU4txt", [](const std::string& unused, std::istream& theStream) {});
-	registerKeyword("date", [](const std::string& unused, std::istream& theStream)
+	registerKeyword("date", kept([](const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString dateString(theStream);
 			theConfiguration.setLastEU4Date(date(dateString.getString()));
-		});
-	registerKeyword("start_date", [](const std::string& unused, std::istream& theStream)
+		}));
+	registerKeyword("start_date", kept([](const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString startDateString(theStream);
 			theConfiguration.setStartEU4Date(date(startDateString.getString()));
-		});
-	registerRegex("(multiplayer_)?random_seed", [](const std::string& unused, std::istream& theStream)
+		}));
+	registerRegex("(multiplayer_)?random_seed", kept([](const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString randomSeed(theStream);
 			theConfiguration.setEU4RandomSeed(stoi(randomSeed.getString().substr(randomSeed.getString().size() - 5)));
-		});
-	registerKeyword("savegame_version", [this](const std::string& unused, std::istream& theStream)
+		}));
+	registerKeyword("savegame_version", kept([this](const std::string& unused, std::istream& theStream)
 		{
 			version = std::make_unique<Version>(theStream);
 			theConfiguration.setEU4Version(*version);
 			Log(LogLevel::Info) << "Savegave version: " << *version;
-		});
-	registerKeyword("dlc_enabled", [](const std::string& unused, std::istream& theStream)
+		}));
+	registerKeyword("dlc_enabled", kept([](const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::stringList theDLCs(theStream);
 			theConfiguration.setActiveDLCs(theDLCs.getStrings());
-		});
-	registerKeyword("mod_enabled", [](const std::string& unused, std::istream& theStream) 
+		}));
+	registerKeyword("mod_enabled", kept([](const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::stringList modList(theStream);
 			Mods theMods(modList.getStrings(), theConfiguration);
-		});
-	registerKeyword("revolution_target", [this](const std::string& unused, std::istream& theStream)
+		}));
+	registerKeyword("revolution_target", kept([this](const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString revTargetStr(theStream);
 			revolutionTargetString = revTargetStr.getString();
-		});
-	registerKeyword("celestial_empire", [this](const std::string& unused, std::istream& theStream)
+		}));
+	registerKeyword("celestial_empire", kept([this](const std::string& unused, std::istream& theStream)
 		{
 			const EU4Empire empireBlock(theStream);
 			celestialEmperor = empireBlock.getEmperor();
-		});
-	registerKeyword("empire", [this](const std::string& unused, std::istream& theStream)
+		}));
+	registerKeyword("empire", kept([this](const std::string& unused, std::istream& theStream)
 		{
 			const EU4Empire empireBlock(theStream);
 			holyRomanEmperor = empireBlock.getEmperor();
-		});
-	registerKeyword("emperor", [this](const std::string& unused, std::istream& theStream)
+		}));
+	registerKeyword("emperor", kept([this](const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString emperorStr(theStream);
 			holyRomanEmperor = emperorStr.getString();
-		});
-	registerKeyword("provinces", [this](const std::string& unused, std::istream& theStream) 
+		}));
+	// The big sections below don't depend on each other, so they are only cut out of the stream
+	// here and parsed on the shared pool while the main thread scans on. The header keys
+	// (date, start_date, savegame_version, mod_enabled) precede them in the save, so everything
+	// the workers read from theConfiguration is settled by the time they are dispatched.
+	// Blocks cut from a mapped save refer to the mapping, which each task keeps alive.
+	PendingSections pending;
+	registerKeyword("provinces", [this, &pending, &snapshot](const std::string& unused, std::istream& theStream) 
 		{
 			LOG(LogLevel::Info) << "-> Loading Provinces";
 			modifierTypes.initialize();
-			provinces = std::make_unique<Provinces>(theStream);
-
-			const auto& possibleDate = provinces->getProvince(1)->getFirstOwnedDate();
-			if (possibleDate) theConfiguration.setFirstEU4Date(*possibleDate);
+			auto block = helpers::captureValue(theStream);
+			if (snapshot && snapshot->isRecording()) snapshot->record("provinces", block.getText());
+			pending.provinces = helpers::ThreadPool::shared().submit(
+				[block = std::move(block), mapping = saveGame.mappedGamestate]
+				{
+					helpers::ViewStream blockStream(block.getText());
+					return std::make_unique<Provinces>(blockStream);
+				});
 		});
-	registerKeyword("countries", [this, ideaEffectMapper](const std::string& unused, std::istream& theStream)
+	registerKeyword("countries", [this, &pending, &snapshot, ideaEffectMapper](const std::string& unused, std::istream& theStream)
 		{
 			LOG(LogLevel::Info) << "-> Loading Countries";
 			cultureGroupsMapper.initForEU4();
-			const Countries processedCountries(*version, theStream, ideaEffectMapper, cultureGroupsMapper);
-			auto theProcessedCountries = processedCountries.getTheCountries();
-			theCountries.swap(theProcessedCountries);
+			auto block = helpers::captureValue(theStream);
+			if (snapshot && snapshot->isRecording()) snapshot->record("countries", block.getText());
+			pending.countries = helpers::ThreadPool::shared().submit(
+				[this, theVersion = *version, ideaEffectMapper, block = std::move(block), mapping = saveGame.mappedGamestate]
+				{
+					helpers::ViewStream blockStream(block.getText());
+					const Countries processedCountries(theVersion, blockStream, ideaEffectMapper, cultureGroupsMapper);
+					return processedCountries.getTheCountries();
+				});
 		});
-	registerKeyword("diplomacy", [this](const std::string& unused, std::istream& theStream) 
+	registerKeyword("diplomacy", [this, &pending, &snapshot](const std::string& unused, std::istream& theStream) 
 		{
 			LOG(LogLevel::Info) << "-> Loading Diplomacy";
-			const EU4Diplomacy theDiplomacy(theStream);
-			diplomacy = theDiplomacy.getAgreements();
-			LOG(LogLevel::Info) << "-> Loaded " << diplomacy.size() << " agreements";
+			auto block = helpers::captureValue(theStream);
+			if (snapshot && snapshot->isRecording()) snapshot->record("diplomacy", block.getText());
+			pending.diplomacy = helpers::ThreadPool::shared().submit(
+				[block = std::move(block), mapping = saveGame.mappedGamestate]
+				{
+					helpers::ViewStream blockStream(block.getText());
+					const EU4Diplomacy theDiplomacy(blockStream);
+					return theDiplomacy.getAgreements();
+				});
 		});
 	registerKeyword("map_area_data", [](const std::string& unused, std::istream& theStream) 
 		{
 			LOG(LogLevel::Info) << "-> Loading Map Area Data";
-			commonItems::ignoreItem(unused, theStream);
+			helpers::ignoreItem(unused, theStream);
 			LOG(LogLevel::Info) << "XX Promptly Ignoring Map Area Data.";
 		});
-	registerKeyword("active_war", [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("active_war", [this, &pending, &snapshot](const std::string& unused, std::istream& theStream)
 		{
-			const War newWar(theStream);
-			wars.push_back(newWar);
+			auto block = helpers::captureValue(theStream);
+			if (snapshot && snapshot->isRecording()) snapshot->record("active_war", block.getText());
+			pending.wars.emplace_back(helpers::ThreadPool::shared().submit(
+				[block = std::move(block), mapping = saveGame.mappedGamestate]
+				{
+					helpers::ViewStream blockStream(block.getText());
+					return War(blockStream);
+				}));
 		});
-	registerKeyword("change_price", [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("change_price", kept([this](const std::string& unused, std::istream& theStream)
 		{
 			const TradeGoods theGoods(theStream);
 			tradeGoods = theGoods;
-		});
+		}));
 
-	registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9\\_]+", helpers::ignoreItem);
 
 	superGroupMapper.init();
 
-	LOG(LogLevel::Info) << "-> Verifying EU4 save.";
-	verifySave();
+	if (theConfiguration.getSaveSnapshots()) snapshot = std::make_unique<SaveSnapshot>(theConfiguration.getEU4SaveGamePath());
+	if (snapshot && snapshot->exists())
+	{
+		LOG(LogLevel::Info) << "-> Importing EU4 save snapshot " << snapshot->getPath();
+		saveGame.mappedGamestate = std::make_shared<helpers::MappedFile>(snapshot->getPath());
+		if (!saveGame.mappedGamestate->isOpen()) throw std::runtime_error("Could not open " + snapshot->getPath() + " for parsing.");
+		saveGame.gamestateView = saveGame.mappedGamestate->getView();
+	}
+	else
+	{
+		LOG(LogLevel::Info) << "-> Verifying EU4 save.";
+		verifySave();
+		if (snapshot) snapshot->startRecording();
+	}
 
 	LOG(LogLevel::Info) << "-> Importing EU4 save.";
-	if (!saveGame.compressed)
+	if (!saveGame.gamestatePipe && !saveGame.mappedGamestate)
 	{
-		std::ifstream inBinary(fs::u8path(theConfiguration.getEU4SaveGamePath()), std::ios::binary);
-		if (!inBinary.is_open())
+		saveGame.mappedGamestate = std::make_shared<helpers::MappedFile>(theConfiguration.getEU4SaveGamePath());
+		if (!saveGame.mappedGamestate->isOpen())
 		{
 			LOG(LogLevel::Error) << "Could not open " << theConfiguration.getEU4SaveGamePath() << " for parsing.";
 			throw std::runtime_error("Could not open " + theConfiguration.getEU4SaveGamePath() + " for parsing.");
 		}
-		std::stringstream inStream;
-		inStream << inBinary.rdbuf();
-		saveGame.gamestate = inStream.str();
+		saveGame.gamestateView = saveGame.mappedGamestate->getView();
 	}
 
 	verifySaveContents();
 
-	auto metaData = std::istringstream(saveGame.metadata);
-	auto gameState = std::istringstream(saveGame.gamestate);
+	helpers::ViewStream metaData(saveGame.metadata);
 	parseStream(metaData);
-	parseStream(gameState);
+	if (saveGame.gamestatePipe)
+	{
+		parseStream(*saveGame.gamestatePipe);
+		saveGame.gamestatePipe->rethrowIfFailed();
+	}
+	else
+	{
+		helpers::ViewStream gameState(saveGame.gamestateView);
+		parseStream(gameState);
+	}
 
 	clearRegisteredKeywords();
 
+	LOG(LogLevel::Info) << "-> Collecting parsed sections";
+	if (pending.provinces.valid())
+	{
+		provinces = pending.provinces.get();
+		const auto& possibleDate = provinces->getProvince(1)->getFirstOwnedDate();
+		if (possibleDate) theConfiguration.setFirstEU4Date(*possibleDate);
+	}
+	if (pending.countries.valid()) theCountries = pending.countries.get();
+	if (pending.diplomacy.valid())
+	{
+		diplomacy = pending.diplomacy.get();
+		LOG(LogLevel::Info) << "-> Loaded " << diplomacy.size() << " agreements";
+	}
+	for (auto& war: pending.wars) wars.push_back(war.get());
+	if (snapshot && snapshot->isRecording()) snapshot->finishRecording();
+
+	// Everything we need has been copied out of the save by now.
+	saveGame.gamestateView = std::string_view();
+	saveGame.mappedGamestate.reset();
+	saveGame.gamestatePipe.reset();
+	std::string().swap(saveGame.metadata);
+
 	unitTypeMapper.initUnitTypeMapper();
 
 	LOG(LogLevel::Info) << "*** Building world ***";
@@ -230,10 +344,15 @@ void EU4::World::calculateIndustry() const
 
 void EU4::World::buildPopRatios() const
 {
-	for (const auto& province: provinces->getAllProvinces())
+	// Every province builds its ratios from its own history alone.
+	std::vector<std::shared_ptr<Province>> allProvinces;
+	allProvinces.reserve(provinces->getAllProvinces().size());
+	for (const auto& province: provinces->getAllProvinces()) allProvinces.push_back(province.second);
+
+	helpers::ThreadPool::shared().parallelFor(allProvinces.size(), [this, &allProvinces](const size_t index)
 	{
-		province.second->buildPopRatio(superGroupMapper, *regions);
-	}
+		allProvinces[index]->buildPopRatio(superGroupMapper, *regions);
+	});
 }
 
 void EU4::World::generateNeoCultures()
@@ -351,16 +470,10 @@ void EU4::World::fillHistoricalData()
 	for (const auto& country : theCountries) historicalData.emplace_back(std::make_pair(country.first, country.second->getHistoricalEntry()));
 }
 
-void EU4::World::verifySaveContents()
+void EU4::World::verifySaveContents() const
 {
-	if (
-		saveGame.gamestate[0] == 'E' &&
-		saveGame.gamestate[1] == 'U' &&
-		saveGame.gamestate[2] == '4' &&
-		saveGame.gamestate[3] == 'b' &&
-		saveGame.gamestate[4] == 'i' &&
-		saveGame.gamestate[5] == 'n'
-	) throw std::runtime_error("Ironman saves cannot be converted.");
+	const auto header = saveGame.gamestatePipe ? saveGame.gamestatePipe->peek(6) : saveGame.gamestateView.substr(0, 6);
+	if (header == "EU4bin") throw std::runtime_error("Ironman saves cannot be converted.");
 }
 
 void EU4::World::verifySave()
@@ -383,6 +496,7 @@ bool EU4::World::uncompressSave()
 {
 	auto savefile = ZipFile::Open(theConfiguration.getEU4SaveGamePath());
 	if (!savefile) return false;
+	ZipArchiveEntry::Ptr gamestateEntry;
 	for (size_t entryNum = 0; entryNum < savefile->GetEntriesCount(); ++entryNum)
 	{
 		const auto& entry = savefile->GetEntry(entryNum);
@@ -395,9 +509,8 @@ bool EU4::World::uncompressSave()
 		}
 		else if (name == "gamestate")
 		{
-			LOG(LogLevel::Info) << ">> Uncompressing gamestate";
-			saveGame.gamestate = std::string{ std::istreambuf_iterator<char>(*entry->GetDecompressionStream()),
-				std::istreambuf_iterator<char>() };
+			gamestateEntry = entry;
+			saveGame.compressed = true;
 		}
 		else if (name == "ai")
 		{
@@ -406,6 +519,17 @@ bool EU4::World::uncompressSave()
 		}
 		else throw std::runtime_error("Unrecognized savegame structure!");
 	}
+	if (!gamestateEntry) throw std::runtime_error("Unrecognized savegame structure!");
+
+	// The gamestate is inflated on a background thread in pieces, and parsed as the pieces arrive.
+	// Entries share the archive's file handle, so nothing else may be read from it from here on.
+	LOG(LogLevel::Info) << ">> Uncompressing gamestate while parsing";
+	saveGame.gamestatePipe = std::make_unique<helpers::PipeStream>([savefile, gamestateEntry](helpers::ChunkPipe& pipe)
+		{
+			auto* decompressionStream = gamestateEntry->GetDecompressionStream();
+			if (!decompressionStream) throw std::runtime_error("Could not uncompress the gamestate!");
+			helpers::pumpStream(*decompressionStream, pipe);
+		});
 	return true;
 }
 
@@ -462,10 +586,9 @@ void EU4::World::addProvinceInfoToCountries()
 	// add province core info to countries
 	for (const auto& province: provinces->getAllProvinces())
 	{
-		auto cores = province.second->getCores();
-		for (const auto& core: cores)
+		for (const auto& core: province.second->getCores())
 		{
-			const auto& country = theCountries.find(core);
+			const auto& country = theCountries.find(core.getString());
 			if (country != theCountries.end())
 			{
 				country->second->addCore(province.second);
@@ -507,21 +630,11 @@ void EU4::World::assignProvincesToAreas(const std::map<std::string, std::set<int
 
 void EU4::World::loadEU4RegionsOldVersion()
 {
-	auto regionFilename = theConfiguration.getEU4Path() + "/map/region.txt";
-
-	for (const auto& itr: theConfiguration.getEU4Mods())
-	{
-		if (!Utils::DoesFileExist(itr + "/map/region.txt"))
-		{
-			continue;
-		}
-
-		regionFilename = itr + "/map/region.txt";
-	}
+	const auto regionFilename = theConfiguration.getEU4Files().resolve("map/region.txt");
+	if (!regionFilename) throw std::runtime_error("Could not find map/region.txt!");
 
-	std::ifstream theStream(fs::u8path(regionFilename));
-	Areas installedAreas(theStream);
-	theStream.close();
+	const auto theStream = theConfiguration.getEU4Definitions().open(*regionFilename);
+	Areas installedAreas(*theStream);
 	assignProvincesToAreas(installedAreas.getAreas());
 
 	regions = std::make_unique<Regions>(installedAreas);
@@ -530,62 +643,37 @@ void EU4::World::loadEU4RegionsOldVersion()
 
 void EU4::World::loadEU4RegionsNewVersion()
 {
-	auto areaFilename = theConfiguration.getEU4Path() + "/map/area.txt";
-	auto regionFilename = theConfiguration.getEU4Path() + "/map/region.txt";
-	auto superRegionFilename = theConfiguration.getEU4Path() + "/map/superregion.txt";
-	for (const auto& itr: theConfiguration.getEU4Mods())
-	{
-		if (!Utils::DoesFileExist(itr + "/map/area.txt")) continue;
-		areaFilename = itr + "/map/area.txt";
-	}
-	for (const auto& itr : theConfiguration.getEU4Mods())
-	{
-		if (!Utils::DoesFileExist(itr + "/map/region.txt")) continue;
-		regionFilename = itr + "/map/region.txt";
-	}
-	for (const auto& itr : theConfiguration.getEU4Mods())
-	{
-		if (!Utils::DoesFileExist(itr + "/map/superregion.txt")) continue;
-		superRegionFilename = itr + "/map/superregion.txt";
-	}
+	const auto& files = theConfiguration.getEU4Files();
+	const auto areaFilename = files.resolve("map/area.txt");
+	const auto regionFilename = files.resolve("map/region.txt");
+	const auto superRegionFilename = files.resolve("map/superregion.txt");
+
+	auto& definitions = theConfiguration.getEU4Definitions();
 
-	std::ifstream areaStream(fs::u8path(areaFilename));
-	if (!areaStream.is_open()) throw std::runtime_error("Could not open map/area.txt!");
-	Areas installedAreas(areaStream);
-	areaStream.close();
+	if (!areaFilename) throw std::runtime_error("Could not open map/area.txt!");
+	Areas installedAreas(*definitions.open(*areaFilename));
 	assignProvincesToAreas(installedAreas.getAreas());
 
-	std::ifstream superRegionFile(fs::u8path(superRegionFilename));
-	if (!superRegionFile.is_open()) throw std::runtime_error("Could not open map/superregion.txt!");
-	SuperRegions sRegions(superRegionFile);
-	superRegionFile.close();
+	if (!superRegionFilename) throw std::runtime_error("Could not open map/superregion.txt!");
+	SuperRegions sRegions(*definitions.open(*superRegionFilename));
 
-	std::ifstream regionStream(fs::u8path(regionFilename));
-	if (!regionStream.is_open()) throw std::runtime_error("Could not open map/region.txt!");
-	regions = std::make_unique<Regions>(sRegions, installedAreas, regionStream);
-	regionStream.close();
+	if (!regionFilename) throw std::runtime_error("Could not open map/region.txt!");
+	regions = std::make_unique<Regions>(sRegions, installedAreas, *definitions.open(*regionFilename));
 }
 
 
 void EU4::World::readCommonCountries()
 {
-	std::ifstream commonCountries(fs::u8path(theConfiguration.getEU4Path() + "/common/country_tags/00_countries.txt"));	// the data in the countries file
-	if (!commonCountries.is_open()) throw std::runtime_error("Could not open common/country_tags/00_countries.txt!");
-	readCommonCountriesFile(commonCountries, theConfiguration.getEU4Path());
-	for (const auto& itr: theConfiguration.getEU4Mods())
+	const auto fileNames = theConfiguration.getEU4Files().list("common/country_tags");
+	if (fileNames.empty()) throw std::runtime_error("Could not open common/country_tags/00_countries.txt!");
+	for (const auto& fileName: fileNames)
 	{
-		std::set<std::string> fileNames;
-		Utils::GetAllFilesInFolder(itr + "/common/country_tags/", fileNames);
-		for (const auto& fileItr: fileNames)
-		{
-			std::ifstream convertedCommonCountries(fs::u8path(itr + "/common/country_tags/" + fileItr));	// a stream of the data in the converted countries file
-			if (!convertedCommonCountries.is_open()) throw std::runtime_error("Could not open common/country_tags/" + fileItr + "!");
-			readCommonCountriesFile(convertedCommonCountries, itr);
-		}
+		const auto commonCountries = theConfiguration.getEU4Definitions().open(fileName);	// the data in the countries file
+		readCommonCountriesFile(*commonCountries);
 	}
 }
 
-void EU4::World::readCommonCountriesFile(std::istream& in, const std::string& rootPath)
+void EU4::World::readCommonCountriesFile(std::istream& in)
 {
 	// Add any info from common\countries
 	const int maxLineLength = 10000; // the maximum line length
@@ -623,13 +711,13 @@ void EU4::World::readCommonCountriesFile(std::istream& in, const std::string& ro
 				}
 				std::replace(fileName.begin(), fileName.end(), '/', '/');
 
-				// Parse the country file.
-				auto fullFilename = rootPath + "/common/" + fileName;
-				const auto lastPathSeparatorPos = fullFilename.find_last_of('/');
-				auto localFileName = fullFilename.substr(lastPathSeparatorPos + 1, std::string::npos);
-				if (Utils::DoesFileExist(fullFilename))
+				// Parse the country file, from whichever mod provides it.
+				const auto fullFilename = theConfiguration.getEU4Files().resolve("common/" + fileName);
+				const auto lastPathSeparatorPos = fileName.find_last_of('/');
+				const auto localFileName = fileName.substr(lastPathSeparatorPos + 1, std::string::npos);
+				if (fullFilename)
 				{
-					country->readFromCommonCountry(localFileName, fullFilename);
+					country->readFromCommonCountry(localFileName, *fullFilename);
 				}
 			}
 		}
@@ -638,22 +726,22 @@ void EU4::World::readCommonCountriesFile(std::istream& in, const std::string& ro
 
 void EU4::World::setLocalisations()
 {
-	const EU4Localisation localisation;
+	localisation.readFromAllLocalisationFolders();
 
 	for (const auto& theCountry: theCountries)
 	{
 		const auto& nameLocalisations = localisation.getTextInEachLanguage(theCountry.second->getTag()); // the names in all languages
 		for (const auto& nameLocalisation : nameLocalisations) // the name under consideration
 		{
-			const auto& language = nameLocalisation.first; // the language
-			const auto& name = nameLocalisation.second; // the name of the country in this language
+			const std::string language(nameLocalisation.first); // the language
+			const std::string name(nameLocalisation.second); // the name of the country in this language
 			theCountry.second->setLocalisationName(language, name);
 		}
 		const auto& adjectiveLocalisations = localisation.getTextInEachLanguage(theCountry.second->getTag() + "_ADJ"); // the adjectives in all languages
 		for (const auto& adjectiveLocalisation : adjectiveLocalisations) // the adjective under consideration
 		{
-			const auto& language = adjectiveLocalisation.first; // the language
-			const auto& adjective = adjectiveLocalisation.second; // the adjective for the country in this language
+			const std::string language(adjectiveLocalisation.first); // the language
+			const std::string adjective(adjectiveLocalisation.second); // the adjective for the country in this language
 			theCountry.second->setLocalisationAdjective(language, adjective);
 		}
 	}
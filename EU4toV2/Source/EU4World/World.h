@@ -9,12 +9,15 @@
 #include "Modifiers/Modifiers.h"
 #include "Country/EU4Country.h"
 #include "Wars/EU4War.h"
+#include "Localisation/EU4Localisation.h"
 #include "TradeGoods/EU4TradeGoods.h"
 #include "../Mappers/UnitTypes/UnitTypeMapper.h"
 #include "../Mappers/Buildings/Buildings.h"
 #include "../Mappers/CultureGroups/CultureGroups.h"
 #include "../Mappers/IdeaEffects/IdeaEffectMapper.h"
 #include "../Mappers/SuperGroupMapper/SuperGroupMapper.h"
+#include "../Helpers/MappedFile.h"
+#include "../Helpers/PipeStream.h"
 #include "newParser.h"
 #include <memory>
 #include <map>
@@ -41,10 +44,11 @@ namespace EU4
 		[[nodiscard]] const auto& getProvinces() const { return provinces->getAllProvinces(); }
 		[[nodiscard]] const auto& getHistoricalData() const { return historicalData; }
 		[[nodiscard]] const auto& getNativeCultures() const { return nativeCultures; }
+		[[nodiscard]] const auto& getLocalisation() const { return localisation; }
 		
 	private:
 		void verifySave();
-		void verifySaveContents();
+		void verifySaveContents() const;
 		void loadRevolutionTarget();
 		void dropMinoritiesFromCountries();
 		void addProvinceInfoToCountries();
@@ -52,7 +56,7 @@ namespace EU4
 		void loadEU4RegionsNewVersion();
 		void loadEU4RegionsOldVersion();
 		void readCommonCountries();
-		void readCommonCountriesFile(std::istream&, const std::string& rootPath);
+		void readCommonCountriesFile(std::istream&);
 		void setLocalisations();
 		void resolveRegimentTypes();
 		void mergeNations();
@@ -76,7 +80,9 @@ namespace EU4
 		{
 			bool compressed = false;
 			std::string metadata;
-			std::string gamestate;
+			std::shared_ptr<helpers::MappedFile> mappedGamestate; // uncompressed saves are parsed straight from the mapping
+			std::string_view gamestateView;
+			std::unique_ptr<helpers::PipeStream> gamestatePipe; // compressed saves are inflated while being parsed
 		};
 		saveData saveGame;
 		
@@ -100,6 +106,7 @@ namespace EU4
 		mappers::Buildings buildingTypes;
 		mappers::CultureGroups cultureGroupsMapper;
 		mappers::SuperGroupMapper superGroupMapper;
+		EU4Localisation localisation;
 
 		// export data for hoi4
 		std::vector<std::pair<std::string, HistoricalEntry>> historicalData;
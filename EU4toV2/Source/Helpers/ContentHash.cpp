@@ -0,0 +1,96 @@
+#include "ContentHash.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+	constexpr uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+	constexpr uint64_t PRIME_3 = 0x165667B19E3779F9ULL;
+	constexpr uint64_t PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+
+	uint64_t rotateLeft(const uint64_t value, const int bits)
+	{
+		return value << bits | value >> (64 - bits);
+	}
+
+	uint64_t readWord(const char* bytes)
+	{
+		// Byte by byte, so the result is the same on any platform.
+		uint64_t word = 0;
+		for (auto index = 7; index >= 0; --index) word = word << 8 | static_cast<unsigned char>(bytes[index]);
+		return word;
+	}
+
+	uint64_t mixWord(const uint64_t lane, const uint64_t word)
+	{
+		return rotateLeft(lane + word * PRIME_2, 31) * PRIME_1;
+	}
+}
+
+helpers::ContentHash::ContentHash(): lanes{PRIME_1 + PRIME_2, PRIME_2, 0, 0 - PRIME_1}
+{
+}
+
+void helpers::ContentHash::mixBlock(const char* block)
+{
+	for (size_t lane = 0; lane < lanes.size(); ++lane) lanes[lane] = mixWord(lanes[lane], readWord(block + lane * 8));
+}
+
+helpers::ContentHash& helpers::ContentHash::update(std::string_view bytes)
+{
+	totalSize += bytes.size();
+
+	if (pendingSize > 0)
+	{
+		const auto filling = std::min(BLOCK_SIZE - pendingSize, bytes.size());
+		std::memcpy(pending.data() + pendingSize, bytes.data(), filling);
+		pendingSize += filling;
+		bytes.remove_prefix(filling);
+		if (pendingSize < BLOCK_SIZE) return *this;
+		mixBlock(pending.data());
+		pendingSize = 0;
+	}
+
+	while (bytes.size() >= BLOCK_SIZE)
+	{
+		mixBlock(bytes.data());
+		bytes.remove_prefix(BLOCK_SIZE);
+	}
+
+	std::memcpy(pending.data(), bytes.data(), bytes.size());
+	pendingSize = bytes.size();
+	return *this;
+}
+
+uint64_t helpers::ContentHash::getValue() const
+{
+	auto hash = rotateLeft(lanes[0], 1) + rotateLeft(lanes[1], 7) + rotateLeft(lanes[2], 12) + rotateLeft(lanes[3], 18);
+	for (const auto lane: lanes) hash = (hash ^ mixWord(0, lane)) * PRIME_1 + PRIME_4;
+	hash += totalSize;
+
+	size_t position = 0;
+	for (; position + 8 <= pendingSize; position += 8) hash = rotateLeft(hash ^ mixWord(0, readWord(pending.data() + position)), 27) * PRIME_1 + PRIME_4;
+	for (; position < pendingSize; ++position) hash = rotateLeft(hash ^ static_cast<unsigned char>(pending[position]) * PRIME_3, 11) * PRIME_1;
+
+	hash ^= hash >> 33;
+	hash *= PRIME_2;
+	hash ^= hash >> 29;
+	hash *= PRIME_3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+std::string helpers::ContentHash::toString() const
+{
+	static constexpr char digits[] = "0123456789abcdef";
+	auto value = getValue();
+	std::string text(16, '0');
+	for (auto index = 15; index >= 0; --index)
+	{
+		text[index] = digits[value & 0xF];
+		value >>= 4;
+	}
+	return text;
+}
@@ -0,0 +1,35 @@
+#ifndef CONTENT_HASH_H
+#define CONTENT_HASH_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace helpers
+{
+	// A fast 64-bit hash over any amount of bytes, fed in pieces, for telling whether the content
+	// of a file changed since we last looked at it. Four independent lanes over 32 byte blocks
+	// keep it running at memory speed. It is not a cryptographic hash.
+	class ContentHash
+	{
+	public:
+		ContentHash();
+
+		ContentHash& update(std::string_view bytes);
+
+		[[nodiscard]] uint64_t getValue() const;
+		[[nodiscard]] std::string toString() const; // 16 hex digits
+
+	private:
+		static constexpr size_t BLOCK_SIZE = 32;
+		void mixBlock(const char* block);
+
+		std::array<uint64_t, 4> lanes{};
+		std::array<char, BLOCK_SIZE> pending{};
+		size_t pendingSize = 0;
+		uint64_t totalSize = 0;
+	};
+}
+
+#endif // CONTENT_HASH_H
@@ -0,0 +1,78 @@
+#include "DayNumbers.h"
+
+#include <array>
+
+namespace
+{
+	constexpr int DAYS_PER_YEAR = 365;
+	constexpr std::array<int, 12> daysBeforeMonth{0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+	std::optional<int> scanNumber(std::string_view& text)
+	{
+		if (text.empty() || text.front() < '0' || text.front() > '9') return std::nullopt;
+		auto number = 0;
+		while (!text.empty() && text.front() >= '0' && text.front() <= '9')
+		{
+			number = number * 10 + (text.front() - '0');
+			text.remove_prefix(1);
+		}
+		return number;
+	}
+
+	bool scanDot(std::string_view& text)
+	{
+		if (text.empty() || text.front() != '.') return false;
+		text.remove_prefix(1);
+		return true;
+	}
+}
+
+helpers::DayNumber helpers::toDayNumber(const int year, const int month, const int day)
+{
+	const auto monthIndex = month >= 1 && month <= 12 ? month - 1 : 0;
+	return year * DAYS_PER_YEAR + daysBeforeMonth[monthIndex] + day - 1;
+}
+
+helpers::DayNumber helpers::toDayNumber(const date& theDate)
+{
+	return toDayNumber(theDate.getYear(), theDate.getMonth(), theDate.getDay());
+}
+
+date helpers::toDate(const DayNumber dayNumber)
+{
+	auto year = dayNumber / DAYS_PER_YEAR;
+	auto dayInYear = dayNumber % DAYS_PER_YEAR;
+	if (dayInYear < 0)
+	{
+		--year;
+		dayInYear += DAYS_PER_YEAR;
+	}
+
+	auto month = 12;
+	while (daysBeforeMonth[month - 1] > dayInYear) --month;
+	return date(year, month, dayInYear - daysBeforeMonth[month - 1] + 1);
+}
+
+std::optional<helpers::DayNumber> helpers::parseDayNumber(std::string_view text)
+{
+	const auto year = scanNumber(text);
+	if (!year || !scanDot(text)) return std::nullopt;
+	const auto month = scanNumber(text);
+	if (!month || !scanDot(text)) return std::nullopt;
+	const auto day = scanNumber(text);
+	if (!day || !text.empty()) return std::nullopt;
+	return toDayNumber(*year, *month, *day);
+}
+
+float helpers::yearsBetween(const DayNumber later, const DayNumber earlier)
+{
+	// Whole years and the day-in-year difference are kept apart, as date::diffInYears does.
+	const auto floorYear = [](const DayNumber dayNumber) {
+		return dayNumber >= 0 ? dayNumber / DAYS_PER_YEAR : (dayNumber - DAYS_PER_YEAR + 1) / DAYS_PER_YEAR;
+	};
+	const auto laterYear = floorYear(later);
+	const auto earlierYear = floorYear(earlier);
+	const auto years = static_cast<float>(laterYear - earlierYear);
+	const auto days = (later - laterYear * DAYS_PER_YEAR) - (earlier - earlierYear * DAYS_PER_YEAR);
+	return years + static_cast<float>(days) / DAYS_PER_YEAR;
+}
@@ -0,0 +1,25 @@
+#ifndef DAY_NUMBERS_H
+#define DAY_NUMBERS_H
+
+#include "Date.h"
+#include <optional>
+#include <string_view>
+
+namespace helpers
+{
+	// Dates packed into a single integer - days since 0.1.1 on the 365 day calendar EU4 uses -
+	// so history entries can be stored, ordered and subtracted without going through date.
+	using DayNumber = int;
+
+	DayNumber toDayNumber(int year, int month, int day);
+	DayNumber toDayNumber(const date& theDate);
+	date toDate(DayNumber dayNumber);
+
+	// Reads "year.month.day" straight from the text, or nothing if the text is anything else.
+	std::optional<DayNumber> parseDayNumber(std::string_view text);
+
+	// Same as date::diffInYears for the two dates.
+	float yearsBetween(DayNumber later, DayNumber earlier);
+}
+
+#endif // DAY_NUMBERS_H
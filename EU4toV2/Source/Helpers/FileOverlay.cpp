@@ -0,0 +1,70 @@
+#include "FileOverlay.h"
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <set>
+namespace fs = std::filesystem;
+
+namespace
+{
+	std::string trimSeparators(std::string path)
+	{
+		while (!path.empty() && (path.back() == '/' || path.back() == '\\')) path.pop_back();
+		return path;
+	}
+
+	std::set<std::string> filesInFolder(const std::string& folderPath)
+	{
+		std::set<std::string> fileNames;
+		std::error_code error;
+		for (fs::directory_iterator entry(fs::u8path(folderPath), error), end; !error && entry != end; entry.increment(error))
+		{
+			if (entry->is_regular_file(error)) fileNames.insert(entry->path().filename().u8string());
+		}
+		return fileNames;
+	}
+}
+
+std::optional<std::string> helpers::FileOverlay::resolve(const std::string& relativePath) const
+{
+	const auto trimmedPath = trimSeparators(relativePath);
+	const auto separator = trimmedPath.find_last_of("/\\");
+	const auto folder = separator == std::string::npos ? std::string() : trimmedPath.substr(0, separator);
+	const auto fileName = separator == std::string::npos ? trimmedPath : trimmedPath.substr(separator + 1);
+
+	const auto& index = indexFolder(folder);
+	const auto file = index.fileNames.find(fileName);
+	if (file == index.fileNames.end()) return std::nullopt;
+	return index.files[file->second];
+}
+
+std::vector<std::string> helpers::FileOverlay::list(const std::string& relativeFolder) const
+{
+	return indexFolder(trimSeparators(relativeFolder)).files;
+}
+
+const helpers::FileOverlay::FolderIndex& helpers::FileOverlay::indexFolder(const std::string& relativeFolder) const
+{
+	const std::lock_guard<std::mutex> guard(lock);
+	if (const auto known = folders.find(relativeFolder); known != folders.end()) return known->second;
+
+	std::map<std::string, size_t> winners; // file name, root
+	for (size_t root = 0; root < roots.size(); ++root)
+	{
+		const auto folderPath = relativeFolder.empty() ? roots[root] : roots[root] + "/" + relativeFolder;
+		for (const auto& fileName: filesInFolder(folderPath)) winners[fileName] = root;
+	}
+
+	std::vector<std::pair<size_t, std::string>> loadOrder;
+	loadOrder.reserve(winners.size());
+	for (const auto& [fileName, root]: winners) loadOrder.emplace_back(root, fileName);
+	std::sort(loadOrder.begin(), loadOrder.end());
+
+	FolderIndex index;
+	for (const auto& [root, fileName]: loadOrder)
+	{
+		index.fileNames.emplace(fileName, index.files.size());
+		index.files.push_back((relativeFolder.empty() ? roots[root] : roots[root] + "/" + relativeFolder) + "/" + fileName);
+	}
+	return folders.emplace(relativeFolder, std::move(index)).first->second;
+}
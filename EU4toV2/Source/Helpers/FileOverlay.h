@@ -0,0 +1,51 @@
+#ifndef FILE_OVERLAY_H
+#define FILE_OVERLAY_H
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace helpers
+{
+	// Several root folders - the game install and then each mod - laid over each other, so that
+	// a file in a later root hides the file with the same relative path in the earlier ones.
+	// Each folder is listed once per root the first time it is asked for and remembered, after
+	// which lookups are hash lookups instead of file system calls. Safe to use from several threads.
+	class FileOverlay
+	{
+	public:
+		FileOverlay() = default;
+		explicit FileOverlay(std::vector<std::string> theRoots): roots(std::move(theRoots)) {}
+		FileOverlay(const FileOverlay&) = delete;
+		FileOverlay(FileOverlay&&) = delete;
+		FileOverlay& operator=(const FileOverlay&) = delete;
+		FileOverlay& operator=(FileOverlay&&) = delete;
+
+		// Full path of the winning file for a relative path like "map/area.txt", if any root has it.
+		[[nodiscard]] std::optional<std::string> resolve(const std::string& relativePath) const;
+
+		// Full paths of the winning files directly inside a relative folder like "common/religions".
+		// Files come in the order they used to be loaded in: those won by the install first, then
+		// those of each mod in turn, each group sorted by name.
+		[[nodiscard]] std::vector<std::string> list(const std::string& relativeFolder) const;
+
+		[[nodiscard]] const auto& getRoots() const { return roots; }
+
+	private:
+		struct FolderIndex
+		{
+			std::vector<std::string> files; // full paths, in load order
+			std::unordered_map<std::string, size_t> fileNames; // name to position in files
+		};
+		const FolderIndex& indexFolder(const std::string& relativeFolder) const;
+
+		std::vector<std::string> roots; // lowest priority first
+
+		mutable std::mutex lock;
+		mutable std::unordered_map<std::string, FolderIndex> folders;
+	};
+}
+
+#endif // FILE_OVERLAY_H
@@ -0,0 +1,151 @@
+#include "FilePack.h"
+#include "ViewStream.h"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+namespace fs = std::filesystem;
+
+namespace
+{
+	// Bump whenever the layout changes, older packs are then ignored.
+	constexpr std::string_view PACK_HEADER = "EU4toVic2 file pack 1\n";
+}
+
+std::optional<std::string_view> helpers::FilePack::read(const std::string& filePath)
+{
+	const auto current = statFile(filePath);
+	if (!current) return std::nullopt;
+
+	{
+		const std::lock_guard<std::mutex> guard(lock);
+		loadPack();
+		if (const auto packed = entries.find(filePath);
+			 packed != entries.end() && packed->second.size == current->size && packed->second.modified == current->modified)
+		{
+			used.insert(filePath);
+			return packed->second.contents;
+		}
+	}
+
+	// Misses are read without holding the lock so that threads loading different files don't queue up.
+	std::ifstream file(fs::u8path(filePath), std::ios::binary);
+	if (!file.is_open()) return std::nullopt;
+	std::string contents{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+	const std::lock_guard<std::mutex> guard(lock);
+	used.insert(filePath);
+	if (const auto alreadyRead = readFromDisk.find(filePath); alreadyRead != readFromDisk.end()) return entries.at(filePath).contents;
+	const auto& stored = readFromDisk.insert(std::make_pair(filePath, std::move(contents))).first->second;
+
+	auto entry = *current;
+	entry.contents = stored;
+	entries[filePath] = entry;
+	return entry.contents;
+}
+
+std::unique_ptr<std::istream> helpers::FilePack::open(const std::string& filePath)
+{
+	auto stream = tryOpen(filePath);
+	if (!stream) return std::make_unique<ViewStream>(std::string_view());
+	return stream;
+}
+
+std::unique_ptr<std::istream> helpers::FilePack::tryOpen(const std::string& filePath)
+{
+	auto contents = read(filePath);
+	if (!contents) return nullptr;
+	if (contents->substr(0, 3) == "\xEF\xBB\xBF") contents->remove_prefix(3);
+	return std::make_unique<ViewStream>(*contents);
+}
+
+void helpers::FilePack::save()
+{
+	const std::lock_guard<std::mutex> guard(lock);
+	if (readFromDisk.empty() && used.size() == entries.size()) return;
+
+	// Unique, so runs with the same mod list never write into the same file.
+	const auto temporaryPath = packPath + ".tmp" + std::to_string(std::random_device()());
+	std::error_code error;
+	fs::create_directories(fs::u8path(packPath).parent_path(), error);
+	std::ofstream pack(fs::u8path(temporaryPath), std::ios::binary | std::ios::trunc);
+	pack << PACK_HEADER;
+	for (const auto& filePath: used)
+	{
+		const auto& entry = entries.at(filePath);
+		pack << filePath << '\t' << entry.size << '\t' << entry.modified << '\t' << entry.contents.size() << '\n';
+		pack.write(entry.contents.data(), static_cast<std::streamsize>(entry.contents.size()));
+		pack << '\n';
+	}
+	pack.close();
+
+	// The old pack has to be let go of before it can be replaced.
+	entries.clear();
+	readFromDisk.clear();
+	used.clear();
+	packFile.reset();
+	packLoaded = false;
+
+	if (!pack.fail()) fs::rename(fs::u8path(temporaryPath), fs::u8path(packPath), error);
+	if (pack.fail() || error) fs::remove(fs::u8path(temporaryPath), error);
+}
+
+void helpers::FilePack::loadPack()
+{
+	if (packLoaded) return;
+	packLoaded = true;
+
+	packFile = std::make_unique<MappedFile>(packPath);
+	if (!packFile->isOpen()) return;
+	auto remaining = packFile->getView();
+	if (remaining.substr(0, PACK_HEADER.size()) != PACK_HEADER) return;
+	remaining.remove_prefix(PACK_HEADER.size());
+
+	// Each file is a line of path, size, modification time and length, separated by tabs,
+	// then that many bytes of contents and a newline.
+	std::map<std::string, Entry> packedEntries;
+	while (!remaining.empty())
+	{
+		const auto lineEnd = remaining.find('\n');
+		if (lineEnd == std::string_view::npos) return;
+		const std::string line(remaining.substr(0, lineEnd));
+		remaining.remove_prefix(lineEnd + 1);
+
+		const auto firstTab = line.find('\t');
+		const auto secondTab = line.find('\t', firstTab + 1);
+		const auto thirdTab = line.find('\t', secondTab + 1);
+		if (firstTab == std::string::npos || secondTab == std::string::npos || thirdTab == std::string::npos) return;
+
+		Entry entry;
+		size_t length = 0;
+		try
+		{
+			entry.size = std::stoull(line.substr(firstTab + 1, secondTab - firstTab - 1));
+			entry.modified = std::stoll(line.substr(secondTab + 1, thirdTab - secondTab - 1));
+			length = std::stoull(line.substr(thirdTab + 1));
+		}
+		catch (std::exception&)
+		{
+			return;
+		}
+		if (length + 1 > remaining.size()) return;
+		entry.contents = remaining.substr(0, length);
+		remaining.remove_prefix(length + 1);
+		packedEntries.insert(std::make_pair(line.substr(0, firstTab), entry));
+	}
+
+	// Only a pack that was read to the end is trusted.
+	entries = std::move(packedEntries);
+}
+
+std::optional<helpers::FilePack::Entry> helpers::FilePack::statFile(const std::string& filePath)
+{
+	std::error_code error;
+	const auto path = fs::u8path(filePath);
+	Entry entry;
+	entry.size = fs::file_size(path, error);
+	if (error) return std::nullopt;
+	entry.modified = static_cast<long long>(fs::last_write_time(path, error).time_since_epoch().count());
+	if (error) return std::nullopt;
+	return entry;
+}
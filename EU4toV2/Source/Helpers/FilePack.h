@@ -0,0 +1,68 @@
+#ifndef FILE_PACK_H
+#define FILE_PACK_H
+
+#include "MappedFile.h"
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+
+namespace helpers
+{
+	// The contents of many small files kept together in a single pack file on disk, so that the
+	// next run maps one file instead of opening hundreds. Every packed file is stored with the
+	// size and modification time it had, and is only served from the pack while the file on
+	// disk still matches them. Anything else is read from disk and goes into the pack on save().
+	// Safe to use from several threads.
+	class FilePack
+	{
+	public:
+		explicit FilePack(std::string thePackPath): packPath(std::move(thePackPath)) {}
+		FilePack(const FilePack&) = delete;
+		FilePack(FilePack&&) = delete;
+		FilePack& operator=(const FilePack&) = delete;
+		FilePack& operator=(FilePack&&) = delete;
+
+		// Contents of the file, or nullopt if it can't be read. The view stays valid until save().
+		[[nodiscard]] std::optional<std::string_view> read(const std::string& filePath);
+
+		// A stream over the file's contents without a UTF-8 BOM, for parsers. Empty if the file
+		// can't be read. Must not outlive the pack or be used after save().
+		[[nodiscard]] std::unique_ptr<std::istream> open(const std::string& filePath);
+		// As open(), but nullptr if the file can't be read.
+		[[nodiscard]] std::unique_ptr<std::istream> tryOpen(const std::string& filePath);
+
+		// Rewrites the pack with every file read since it was opened, if anything changed. All
+		// views and streams handed out so far become invalid, later reads use the new pack.
+		void save();
+
+		[[nodiscard]] const auto& getPackPath() const { return packPath; }
+
+	private:
+		struct Entry
+		{
+			uintmax_t size = 0;
+			long long modified = 0;
+			std::string_view contents;
+		};
+
+		void loadPack();
+		[[nodiscard]] static std::optional<Entry> statFile(const std::string& filePath);
+
+		std::string packPath;
+		bool packLoaded = false;
+		std::unique_ptr<MappedFile> packFile;
+		std::map<std::string, Entry> entries; // file path, entry
+		std::map<std::string, std::string> readFromDisk; // file path, contents the new entries point to
+		std::set<std::string> used;
+
+		std::mutex lock;
+	};
+}
+
+#endif // FILE_PACK_H
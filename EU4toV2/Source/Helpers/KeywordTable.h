@@ -0,0 +1,63 @@
+#ifndef KEYWORD_TABLE_H
+#define KEYWORD_TABLE_H
+
+#include "newParser.h"
+#include <functional>
+#include <istream>
+#include <string>
+#include <tuple>
+
+namespace helpers
+{
+	// A parser whose keywords are registered once instead of by every object it fills. Handlers are
+	// handed the object being parsed (plus any extra context) rather than capturing it, so a single
+	// table serves all objects of a type. A table carries state while parsing, so keep one per thread:
+	//
+	//	thread_local helpers::KeywordTable<Province> keywords(registerKeywords);
+	//	keywords.parse(*this, theStream);
+	template <typename Target, typename... Context> class KeywordTable: commonItems::parser
+	{
+	public:
+		using Handler = std::function<void(Target&, const Context&..., const std::string&, std::istream&)>;
+
+		explicit KeywordTable(const std::function<void(KeywordTable&)>& registration) { registration(*this); }
+		KeywordTable(const KeywordTable&) = delete;
+		KeywordTable(KeywordTable&&) = delete;
+		KeywordTable& operator=(const KeywordTable&) = delete;
+		KeywordTable& operator=(KeywordTable&&) = delete;
+
+		void registerKeyword(const std::string& keyword, Handler handler) { parser::registerKeyword(keyword, bind(std::move(handler))); }
+		void registerRegex(const std::string& regex, Handler handler) { parser::registerRegex(regex, bind(std::move(handler))); }
+		// For handlers that don't touch the target, such as commonItems::ignoreItem.
+		void registerRegex(const std::string& regex, const commonItems::parsingFunction& function) { parser::registerRegex(regex, function); }
+
+		void parse(Target& target, const Context&... context, std::istream& theStream)
+		{
+			// A handler may parse a nested object of the same type through the same table.
+			const auto outer = bound;
+			bound = std::make_tuple(&target, &context...);
+			try
+			{
+				parseStream(theStream);
+			}
+			catch (...)
+			{
+				bound = outer;
+				throw;
+			}
+			bound = outer;
+		}
+
+	private:
+		commonItems::parsingFunction bind(Handler handler)
+		{
+			return [this, handler = std::move(handler)](const std::string& keyword, std::istream& theStream) {
+				std::apply([&](Target* target, const Context*... context) { handler(*target, *context..., keyword, theStream); }, bound);
+			};
+		}
+
+		std::tuple<Target*, const Context*...> bound;
+	};
+}
+
+#endif // KEYWORD_TABLE_H
@@ -0,0 +1,116 @@
+#include "MappedFile.h"
+#include <filesystem>
+namespace fs = std::filesystem;
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+helpers::MappedFile::MappedFile(const std::string& filePath)
+{
+	const auto widePath = fs::u8path(filePath).wstring();
+	fileHandle = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		fileHandle = nullptr;
+		return;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(fileHandle, &fileSize))
+	{
+		close();
+		return;
+	}
+	size = static_cast<size_t>(fileSize.QuadPart);
+	if (!size)
+	{
+		// Empty files cannot be mapped, but they are perfectly valid (empty) views.
+		opened = true;
+		return;
+	}
+
+	mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mappingHandle)
+	{
+		close();
+		return;
+	}
+	data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+	if (!data)
+	{
+		close();
+		return;
+	}
+	opened = true;
+}
+
+void helpers::MappedFile::close()
+{
+	if (data) UnmapViewOfFile(data);
+	if (mappingHandle) CloseHandle(mappingHandle);
+	if (fileHandle) CloseHandle(fileHandle);
+	data = nullptr;
+	mappingHandle = nullptr;
+	fileHandle = nullptr;
+	size = 0;
+	opened = false;
+}
+
+#else
+
+helpers::MappedFile::MappedFile(const std::string& filePath)
+{
+	fileDescriptor = open(fs::u8path(filePath).c_str(), O_RDONLY);
+	if (fileDescriptor < 0) return;
+
+	struct stat fileStats{};
+	if (fstat(fileDescriptor, &fileStats) != 0)
+	{
+		close();
+		return;
+	}
+	size = static_cast<size_t>(fileStats.st_size);
+	if (!size)
+	{
+		// Empty files cannot be mapped, but they are perfectly valid (empty) views.
+		opened = true;
+		return;
+	}
+
+	auto* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+	if (mapping == MAP_FAILED)
+	{
+		close();
+		return;
+	}
+	madvise(mapping, size, MADV_SEQUENTIAL);
+	data = static_cast<const char*>(mapping);
+	opened = true;
+}
+
+void helpers::MappedFile::close()
+{
+	if (data) munmap(const_cast<char*>(data), size);
+	if (fileDescriptor >= 0) ::close(fileDescriptor);
+	data = nullptr;
+	fileDescriptor = -1;
+	size = 0;
+	opened = false;
+}
+
+#endif
+
+helpers::MappedFile::~MappedFile()
+{
+	close();
+}
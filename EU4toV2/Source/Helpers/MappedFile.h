@@ -0,0 +1,42 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <string_view>
+
+namespace helpers
+{
+	// Read-only memory mapping of a file on disk. The contents are paged in by the OS on
+	// demand and are never copied into our own buffers. The view is valid for as long as
+	// the MappedFile object lives.
+	class MappedFile
+	{
+	public:
+		explicit MappedFile(const std::string& filePath);
+		~MappedFile();
+		MappedFile(const MappedFile&) = delete;
+		MappedFile(MappedFile&&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile& operator=(MappedFile&&) = delete;
+
+		[[nodiscard]] auto isOpen() const { return opened; }
+		[[nodiscard]] auto getSize() const { return size; }
+		[[nodiscard]] std::string_view getView() const { return std::string_view(data, size); }
+
+	private:
+		void close();
+
+		const char* data = nullptr;
+		size_t size = 0;
+		bool opened = false;
+
+#ifdef _WIN32
+		void* fileHandle = nullptr;
+		void* mappingHandle = nullptr;
+#else
+		int fileDescriptor = -1;
+#endif
+	};
+}
+
+#endif // MAPPED_FILE_H
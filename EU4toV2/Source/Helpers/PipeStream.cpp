@@ -0,0 +1,121 @@
+#include "PipeStream.h"
+#include <algorithm>
+#include <stdexcept>
+
+helpers::ChunkPipe::ChunkPipe(const size_t maxChunks): maxChunks(std::max<size_t>(maxChunks, 1))
+{
+}
+
+bool helpers::ChunkPipe::push(std::string chunk)
+{
+	std::unique_lock<std::mutex> guard(lock);
+	notFull.wait(guard, [this] { return abandoned || chunks.size() < maxChunks; });
+	if (abandoned) return false;
+	chunks.emplace_back(std::move(chunk));
+	notEmpty.notify_one();
+	return true;
+}
+
+void helpers::ChunkPipe::close()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	closed = true;
+	notEmpty.notify_one();
+}
+
+void helpers::ChunkPipe::fail(std::exception_ptr error)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	failure = std::move(error);
+	closed = true;
+	notEmpty.notify_one();
+}
+
+std::optional<std::string> helpers::ChunkPipe::pop()
+{
+	std::unique_lock<std::mutex> guard(lock);
+	notEmpty.wait(guard, [this] { return closed || !chunks.empty(); });
+	if (chunks.empty()) return std::nullopt;
+	auto chunk = std::move(chunks.front());
+	chunks.pop_front();
+	notFull.notify_one();
+	return chunk;
+}
+
+void helpers::ChunkPipe::abandon()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	abandoned = true;
+	chunks.clear();
+	notFull.notify_one();
+}
+
+void helpers::ChunkPipe::rethrowIfFailed() const
+{
+	std::lock_guard<std::mutex> guard(lock);
+	if (failure) std::rethrow_exception(failure);
+}
+
+std::string_view helpers::PipeStreamBuf::peek(const size_t count)
+{
+	if (gptr() == egptr() && traits_type::eq_int_type(underflow(), traits_type::eof())) return std::string_view();
+	return std::string_view(gptr(), std::min(count, static_cast<size_t>(egptr() - gptr())));
+}
+
+helpers::PipeStreamBuf::int_type helpers::PipeStreamBuf::underflow()
+{
+	if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+
+	auto chunk = pipe.pop();
+	while (chunk && chunk->empty()) chunk = pipe.pop();
+	if (!chunk) return traits_type::eof();
+
+	// Carry the tail of the previous chunk over so readers can put characters back across the boundary.
+	const auto putbackSize = std::min(PUTBACK_SIZE, currentChunk.size());
+	std::string nextChunk;
+	nextChunk.reserve(putbackSize + chunk->size());
+	nextChunk.append(currentChunk, currentChunk.size() - putbackSize, putbackSize);
+	nextChunk.append(*chunk);
+	currentChunk = std::move(nextChunk);
+
+	setg(currentChunk.data(), currentChunk.data() + putbackSize, currentChunk.data() + currentChunk.size());
+	return traits_type::to_int_type(*gptr());
+}
+
+helpers::PipeStream::PipeStream(std::function<void(ChunkPipe&)> producer, const size_t maxChunks):
+	 std::istream(nullptr), pipe(maxChunks), buffer(pipe)
+{
+	rdbuf(&buffer);
+	producerThread = std::thread([this, producer = std::move(producer)]
+		{
+			try
+			{
+				producer(pipe);
+				pipe.close();
+			}
+			catch (...)
+			{
+				pipe.fail(std::current_exception());
+			}
+		});
+}
+
+helpers::PipeStream::~PipeStream()
+{
+	// Unblocks a producer still waiting on a full pipe if we stopped reading early.
+	pipe.abandon();
+	if (producerThread.joinable()) producerThread.join();
+}
+
+void helpers::pumpStream(std::istream& source, ChunkPipe& pipe, const size_t chunkSize)
+{
+	while (source)
+	{
+		std::string chunk(chunkSize, '\0');
+		source.read(chunk.data(), static_cast<std::streamsize>(chunkSize));
+		chunk.resize(static_cast<size_t>(source.gcount()));
+		if (chunk.empty()) break;
+		if (!pipe.push(std::move(chunk))) return;
+	}
+	if (source.bad()) throw std::runtime_error("Failed reading from source stream!");
+}
@@ -0,0 +1,94 @@
+#ifndef PIPE_STREAM_H
+#define PIPE_STREAM_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <istream>
+#include <mutex>
+#include <optional>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace helpers
+{
+	// Bounded queue of byte chunks between exactly one producer and one consumer thread.
+	// The producer blocks while the queue is full, the consumer while it is empty.
+	class ChunkPipe
+	{
+	public:
+		explicit ChunkPipe(size_t maxChunks);
+
+		// Producer side. push() returns false once the consumer has abandoned the pipe.
+		bool push(std::string chunk);
+		void close();
+		void fail(std::exception_ptr error);
+
+		// Consumer side. pop() returns nullopt once the producer is done and the queue is drained.
+		std::optional<std::string> pop();
+		void abandon();
+		void rethrowIfFailed() const;
+
+	private:
+		const size_t maxChunks;
+		std::deque<std::string> chunks;
+		bool closed = false;
+		bool abandoned = false;
+		std::exception_ptr failure;
+
+		mutable std::mutex lock;
+		std::condition_variable notFull;
+		std::condition_variable notEmpty;
+	};
+
+	class PipeStreamBuf: public std::streambuf
+	{
+	public:
+		explicit PipeStreamBuf(ChunkPipe& thePipe): pipe(thePipe) {}
+
+		// Looks at up to the next count bytes without consuming them. May return fewer
+		// if the data straddles a chunk boundary or the stream is shorter than count.
+		std::string_view peek(size_t count);
+
+	protected:
+		int_type underflow() override;
+
+	private:
+		static constexpr size_t PUTBACK_SIZE = 16;
+
+		ChunkPipe& pipe;
+		std::string currentChunk;
+	};
+
+	// An input stream fed by a producer running on its own thread, so that producing the
+	// data (inflating, reading from disk) overlaps with whatever is consuming the stream.
+	class PipeStream: public std::istream
+	{
+	public:
+		explicit PipeStream(std::function<void(ChunkPipe&)> producer, size_t maxChunks = 8);
+		~PipeStream() override;
+		PipeStream(const PipeStream&) = delete;
+		PipeStream(PipeStream&&) = delete;
+		PipeStream& operator=(const PipeStream&) = delete;
+		PipeStream& operator=(PipeStream&&) = delete;
+
+		std::string_view peek(size_t count) { return buffer.peek(count); }
+
+		// Rethrows whatever the producer failed with. Call after consuming the stream, as
+		// a producer failure looks like a premature end of data to the reader.
+		void rethrowIfFailed() const { pipe.rethrowIfFailed(); }
+
+	private:
+		ChunkPipe pipe;
+		PipeStreamBuf buffer;
+		std::thread producerThread;
+	};
+
+	// Copies a whole stream into the pipe in chunkSize pieces.
+	void pumpStream(std::istream& source, ChunkPipe& pipe, size_t chunkSize = 1024 * 1024);
+}
+
+#endif // PIPE_STREAM_H
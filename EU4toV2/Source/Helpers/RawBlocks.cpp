@@ -0,0 +1,220 @@
+#include "RawBlocks.h"
+#include "ViewStream.h"
+
+#include <array>
+
+namespace
+{
+	constexpr auto END_OF_DATA = std::char_traits<char>::eof();
+
+	// What every byte means to the scanner. Anything not listed is part of a token.
+	enum class ByteClass: unsigned char
+	{
+		token,
+		whitespace,
+		openBrace,
+		closeBrace,
+		quote,
+		equals,
+		comment
+	};
+
+	constexpr std::array<ByteClass, 256> makeByteClasses()
+	{
+		std::array<ByteClass, 256> classes{};
+		classes[' '] = classes['\t'] = classes['\r'] = classes['\n'] = ByteClass::whitespace;
+		classes['{'] = ByteClass::openBrace;
+		classes['}'] = ByteClass::closeBrace;
+		classes['"'] = ByteClass::quote;
+		classes['='] = ByteClass::equals;
+		classes['#'] = ByteClass::comment;
+		return classes;
+	}
+	constexpr auto byteClasses = makeByteClasses();
+
+	ByteClass classify(const int character)
+	{
+		return character == END_OF_DATA ? ByteClass::whitespace : byteClasses[static_cast<unsigned char>(character)];
+	}
+
+	// Memory we can scan in place.
+	struct ViewSource
+	{
+		std::string_view text;
+		size_t position = 0;
+
+		[[nodiscard]] int peek() const { return position < text.size() ? static_cast<unsigned char>(text[position]) : END_OF_DATA; }
+		void bump() { ++position; }
+
+		// Block contents are mostly plain tokens and whitespace, which can be run over without looking back.
+		void skipPlain()
+		{
+			while (position < text.size())
+			{
+				const auto byteClass = byteClasses[static_cast<unsigned char>(text[position])];
+				if (byteClass != ByteClass::token && byteClass != ByteClass::whitespace && byteClass != ByteClass::equals) return;
+				++position;
+			}
+		}
+	};
+
+	// Any other stream, copying what we scan into a sink.
+	struct BufferSource
+	{
+		std::streambuf& buffer;
+		std::string& sink;
+
+		[[nodiscard]] int peek() const { return buffer.sgetc(); }
+		void bump() { sink.push_back(static_cast<char>(buffer.sbumpc())); }
+		void skipPlain() {}
+	};
+
+	// Any other stream, when the scanned text is not wanted.
+	struct DiscardSource
+	{
+		std::streambuf& buffer;
+
+		[[nodiscard]] int peek() const { return buffer.sgetc(); }
+		void bump() { buffer.sbumpc(); }
+		void skipPlain() {}
+	};
+
+	bool endsToken(const int character)
+	{
+		if (character == END_OF_DATA) return true;
+		const auto byteClass = classify(character);
+		return byteClass != ByteClass::token && byteClass != ByteClass::quote;
+	}
+
+	template <typename Source> void skipWhitespace(Source& source)
+	{
+		while (source.peek() != END_OF_DATA && classify(source.peek()) == ByteClass::whitespace) source.bump();
+	}
+
+	template <typename Source> void skipAssignment(Source& source)
+	{
+		skipWhitespace(source);
+		if (source.peek() == '=')
+		{
+			source.bump();
+			skipWhitespace(source);
+		}
+	}
+
+	template <typename Source> void scanQuotedString(Source& source)
+	{
+		source.bump(); // opening quote
+		while (true)
+		{
+			const auto character = source.peek();
+			if (character == END_OF_DATA) return;
+			source.bump();
+			if (character == '\\' && source.peek() != END_OF_DATA) source.bump();
+			else if (character == '"') return;
+		}
+	}
+
+	template <typename Source> void scanComment(Source& source)
+	{
+		while (source.peek() != END_OF_DATA && source.peek() != '\n') source.bump();
+	}
+
+	template <typename Source> void scanBlock(Source& source)
+	{
+		auto depth = 0;
+		while (true)
+		{
+			source.skipPlain();
+			const auto character = source.peek();
+			if (character == END_OF_DATA) return;
+			switch (classify(character))
+			{
+				case ByteClass::quote:
+					scanQuotedString(source);
+					break;
+				case ByteClass::comment:
+					scanComment(source);
+					break;
+				case ByteClass::openBrace:
+					source.bump();
+					++depth;
+					break;
+				case ByteClass::closeBrace:
+					source.bump();
+					if (--depth == 0) return;
+					break;
+				default:
+					source.bump();
+			}
+		}
+	}
+
+	template <typename Source> void scanValue(Source& source)
+	{
+		const auto character = source.peek();
+		if (character == '{') scanBlock(source);
+		else if (character == '"') scanQuotedString(source);
+		else
+		{
+			std::string token;
+			while (!endsToken(source.peek()))
+			{
+				token.push_back(static_cast<char>(source.peek()));
+				source.bump();
+			}
+			// Colors may be written as "rgb { 1 2 3 }" or "hsv { ... }", the block belongs to the value.
+			if (token == "rgb" || token == "hsv")
+			{
+				skipWhitespace(source);
+				if (source.peek() == '{') scanBlock(source);
+			}
+		}
+	}
+}
+
+helpers::RawBlock helpers::captureValue(std::istream& theStream)
+{
+	auto* buffer = theStream.rdbuf();
+	if (!buffer) return RawBlock();
+
+	if (auto* viewBuffer = dynamic_cast<ViewStreamBuf*>(buffer))
+	{
+		ViewSource source{viewBuffer->getRemaining()};
+		skipAssignment(source);
+		const auto start = source.position;
+		scanValue(source);
+		viewBuffer->consume(source.position);
+		return RawBlock(source.text.substr(start, source.position - start));
+	}
+
+	std::string text;
+	BufferSource source{*buffer, text};
+	skipAssignment(source);
+	text.clear();
+	scanValue(source);
+	return RawBlock(std::move(text));
+}
+
+void helpers::skipValue(std::istream& theStream)
+{
+	auto* buffer = theStream.rdbuf();
+	if (!buffer) return;
+
+	if (auto* viewBuffer = dynamic_cast<ViewStreamBuf*>(buffer))
+	{
+		ViewSource source{viewBuffer->getRemaining()};
+		skipAssignment(source);
+		scanValue(source);
+		viewBuffer->consume(source.position);
+		return;
+	}
+
+	DiscardSource source{*buffer};
+	skipAssignment(source);
+	scanValue(source);
+}
+
+void helpers::ignoreItem(const std::string& unused, std::istream& theStream)
+{
+	skipValue(theStream);
+}
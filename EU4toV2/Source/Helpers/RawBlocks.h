@@ -0,0 +1,41 @@
+#ifndef RAW_BLOCKS_H
+#define RAW_BLOCKS_H
+
+#include <istream>
+#include <string>
+#include <string_view>
+
+namespace helpers
+{
+	// The raw text of a single value - "= { ... }", "= token" or "= \"quoted\"" - lifted out of a
+	// stream by brace matching, without tokenizing it. When the stream is a ViewStream the block
+	// refers to the underlying memory instead of copying it, so that memory must outlive the block.
+	class RawBlock
+	{
+	public:
+		RawBlock() = default;
+		explicit RawBlock(std::string text): storage(std::move(text)), owned(true) {}
+		explicit RawBlock(std::string_view text): view(text) {}
+
+		[[nodiscard]] std::string_view getText() const { return owned ? std::string_view(storage) : view; }
+
+	private:
+		std::string storage;
+		std::string_view view;
+		bool owned = false;
+	};
+
+	// Reads the value following a key (which has already been read) and returns its raw text.
+	// The stream is left right after the value, as if the value had been parsed.
+	RawBlock captureValue(std::istream& theStream);
+
+	// Like captureValue, but throws the value away. Nothing is tokenized or copied, the bytes are
+	// only classified to find where the value ends, which makes it far cheaper than
+	// commonItems::ignoreItem for the large parts of a save nobody reads.
+	void skipValue(std::istream& theStream);
+
+	// Drop-in replacement for commonItems::ignoreItem as a keyword handler.
+	void ignoreItem(const std::string& unused, std::istream& theStream);
+}
+
+#endif // RAW_BLOCKS_H
@@ -0,0 +1,32 @@
+#ifndef SPAN_H
+#define SPAN_H
+
+#include <cstddef>
+
+namespace helpers
+{
+	// A view of elements lying one after another in memory that someone else owns, for handing
+	// out lookups without copying them - our stand-in for C++20's std::span. Spans over a
+	// container are only valid while the container is alive and not resized. They can't be taken
+	// of temporaries for that reason.
+	template <typename T> class Span
+	{
+	public:
+		constexpr Span() = default;
+		constexpr Span(T* theElements, const size_t theSize): elements(theElements), count(theSize) {}
+		template <typename Container> constexpr Span(Container& container): elements(container.data()), count(container.size()) {}
+
+		[[nodiscard]] constexpr T* begin() const { return elements; }
+		[[nodiscard]] constexpr T* end() const { return elements + count; }
+		[[nodiscard]] constexpr T* data() const { return elements; }
+		[[nodiscard]] constexpr size_t size() const { return count; }
+		[[nodiscard]] constexpr bool empty() const { return count == 0; }
+		[[nodiscard]] constexpr T& operator[](const size_t index) const { return elements[index]; }
+
+	private:
+		T* elements = nullptr;
+		size_t count = 0;
+	};
+}
+
+#endif // SPAN_H
@@ -0,0 +1,70 @@
+#include "Symbols.h"
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace
+{
+	// Strings are kept in fixed-size chunks, and the chunk array never moves. A string is stored
+	// before its id is handed out, so whoever holds an id can read its string without the lock.
+	class SymbolTable
+	{
+	public:
+		SymbolTable() { chunks[0] = std::make_unique<std::string[]>(CHUNK_SIZE); }
+
+		uint32_t intern(const std::string_view text)
+		{
+			if (text.empty()) return 0;
+			{
+				std::shared_lock<std::shared_mutex> readLock(lock);
+				const auto found = ids.find(text);
+				if (found != ids.end()) return found->second;
+			}
+
+			std::unique_lock<std::shared_mutex> writeLock(lock);
+			const auto found = ids.find(text);
+			if (found != ids.end()) return found->second;
+
+			const auto id = count;
+			if (id >> CHUNK_BITS >= chunks.size()) throw std::runtime_error("Too many distinct identifiers to intern!");
+			auto& chunk = chunks[id >> CHUNK_BITS];
+			if (!chunk) chunk = std::make_unique<std::string[]>(CHUNK_SIZE);
+			auto& string = chunk[id & CHUNK_MASK];
+			string = text;
+			ids.emplace(std::string_view(string), id);
+			++count;
+			return id;
+		}
+
+		const std::string& lookUp(const uint32_t id) const { return chunks[id >> CHUNK_BITS][id & CHUNK_MASK]; }
+
+	private:
+		static constexpr uint32_t CHUNK_BITS = 12;
+		static constexpr uint32_t CHUNK_SIZE = 1u << CHUNK_BITS;
+		static constexpr uint32_t CHUNK_MASK = CHUNK_SIZE - 1;
+
+		std::shared_mutex lock;
+		std::array<std::unique_ptr<std::string[]>, 4096> chunks; // 16M strings, id 0 is the empty one
+		uint32_t count = 1;
+		std::unordered_map<std::string_view, uint32_t> ids; // views of the strings in chunks
+	};
+
+	SymbolTable& symbolTable()
+	{
+		static SymbolTable theTable;
+		return theTable;
+	}
+}
+
+helpers::Symbol::Symbol(const std::string_view text): id(symbolTable().intern(text))
+{
+}
+
+const std::string& helpers::Symbol::getString() const
+{
+	return symbolTable().lookUp(id);
+}
@@ -0,0 +1,47 @@
+#ifndef SYMBOLS_H
+#define SYMBOLS_H
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace helpers
+{
+	// An identifier - tag, culture, religion, trade good - interned in a process-wide table.
+	// Every distinct string is stored once and a Symbol is only its 32-bit id, so holding one is
+	// cheap and testing two for equality is an integer compare. Symbols order alphabetically by
+	// their strings, as the strings did, so ordered containers of them come out the same in every
+	// run however threads happened to intern them. The default Symbol is the empty string.
+	// Interning and looking up are safe from any thread, looking up never locks.
+	class Symbol
+	{
+	public:
+		Symbol() = default;
+		explicit Symbol(std::string_view text);
+
+		[[nodiscard]] const std::string& getString() const;
+		[[nodiscard]] auto getId() const { return id; }
+		[[nodiscard]] auto empty() const { return id == 0; }
+
+		bool operator==(const Symbol& rhs) const { return id == rhs.id; }
+		bool operator!=(const Symbol& rhs) const { return id != rhs.id; }
+		bool operator<(const Symbol& rhs) const { return id != rhs.id && getString() < rhs.getString(); }
+
+	private:
+		uint32_t id = 0;
+	};
+
+	inline std::ostream& operator<<(std::ostream& output, const Symbol& symbol) { return output << symbol.getString(); }
+}
+
+namespace std
+{
+	template <> struct hash<helpers::Symbol>
+	{
+		size_t operator()(const helpers::Symbol& symbol) const noexcept { return symbol.getId(); }
+	};
+}
+
+#endif // SYMBOLS_H
@@ -0,0 +1,123 @@
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace
+{
+	struct ParallelForState
+	{
+		ParallelForState(const size_t theCount, const std::function<void(size_t)>& theBody): count(theCount), body(theBody) {}
+
+		// Helpers that only get to run after the caller is done must not touch the body anymore.
+		bool enter()
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			if (closed) return false;
+			++active;
+			return true;
+		}
+
+		void leave()
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			if (--active == 0) finished.notify_all();
+		}
+
+		void run()
+		{
+			for (auto index = next++; index < count; index = next++)
+			{
+				try
+				{
+					body(index);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> guard(lock);
+					if (!failure) failure = std::current_exception();
+					next = count;
+				}
+			}
+		}
+
+		const size_t count;
+		const std::function<void(size_t)>& body;
+		std::atomic<size_t> next{0};
+
+		std::mutex lock;
+		std::condition_variable finished;
+		size_t active = 0;
+		bool closed = false;
+		std::exception_ptr failure;
+	};
+}
+
+helpers::ThreadPool::ThreadPool(const size_t threadCount)
+{
+	const auto count = std::max<size_t>(threadCount, 1);
+	workers.reserve(count);
+	for (size_t i = 0; i < count; ++i) workers.emplace_back([this] { work(); });
+}
+
+helpers::ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+	}
+	jobAvailable.notify_all();
+	for (auto& worker: workers) worker.join();
+}
+
+helpers::ThreadPool& helpers::ThreadPool::shared()
+{
+	static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 2u));
+	return pool;
+}
+
+void helpers::ThreadPool::enqueue(std::function<void()> job)
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		jobs.emplace_back(std::move(job));
+	}
+	jobAvailable.notify_one();
+}
+
+void helpers::ThreadPool::work()
+{
+	while (true)
+	{
+		std::function<void()> job;
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			jobAvailable.wait(guard, [this] { return stopping || !jobs.empty(); });
+			if (jobs.empty()) return; // stopping, and nothing left to drain
+			job = std::move(jobs.front());
+			jobs.pop_front();
+		}
+		job(); // packaged tasks capture their own exceptions
+	}
+}
+
+void helpers::ThreadPool::parallelFor(const size_t count, const std::function<void(size_t)>& body)
+{
+	if (count == 0) return;
+
+	auto state = std::make_shared<ParallelForState>(count, body);
+	const auto helperCount = std::min(count - 1, workers.size());
+	for (size_t i = 0; i < helperCount; ++i)
+		enqueue([state] {
+			if (!state->enter()) return;
+			state->run();
+			state->leave();
+		});
+
+	state->run();
+
+	std::unique_lock<std::mutex> guard(state->lock);
+	state->closed = true;
+	state->finished.wait(guard, [&state] { return state->active == 0; });
+	if (state->failure) std::rethrow_exception(state->failure);
+}
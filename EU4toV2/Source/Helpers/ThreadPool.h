@@ -0,0 +1,61 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace helpers
+{
+	// Fixed set of worker threads for the parts of the conversion that parse or load in parallel.
+	// Jobs must not block waiting on other jobs of the same pool - a pool thread waiting on a
+	// queued job can deadlock. Only the main thread waits on futures.
+	class ThreadPool
+	{
+	public:
+		explicit ThreadPool(size_t threadCount);
+		~ThreadPool();
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		ThreadPool& operator=(ThreadPool&&) = delete;
+
+		// Process-wide pool sized to the machine.
+		static ThreadPool& shared();
+
+		template <typename Function> auto submit(Function&& function)
+		{
+			using Result = std::invoke_result_t<std::decay_t<Function>&>;
+			auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+			auto result = task->get_future();
+			enqueue([task] { (*task)(); });
+			return result;
+		}
+
+		// Runs body(0) .. body(count - 1) on the pool and on the calling thread, handing indices out
+		// one at a time so that large and small items even out. The caller works along instead of
+		// blocking and only waits for helpers that actually got started, so unlike waiting on a
+		// future this is safe to call from inside a pool job. The first exception is rethrown.
+		void parallelFor(size_t count, const std::function<void(size_t)>& body);
+
+		[[nodiscard]] auto getThreadCount() const { return workers.size(); }
+
+	private:
+		void enqueue(std::function<void()> job);
+		void work();
+
+		std::vector<std::thread> workers;
+		std::deque<std::function<void()>> jobs;
+		bool stopping = false;
+		std::mutex lock;
+		std::condition_variable jobAvailable;
+	};
+}
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,33 @@
+#include "ViewStream.h"
+
+helpers::ViewStreamBuf::ViewStreamBuf(const std::string_view view)
+{
+	// The get area is never written through, the cast only satisfies std::streambuf's interface.
+	auto* begin = const_cast<char*>(view.data());
+	setg(begin, begin, begin + view.size());
+}
+
+helpers::ViewStreamBuf::pos_type helpers::ViewStreamBuf::seekoff(const off_type offset, const std::ios_base::seekdir direction, const std::ios_base::openmode which)
+{
+	if (!(which & std::ios_base::in)) return pos_type(off_type(-1));
+
+	off_type base;
+	if (direction == std::ios_base::beg) base = 0;
+	else if (direction == std::ios_base::cur) base = gptr() - eback();
+	else base = egptr() - eback();
+
+	const auto target = base + offset;
+	if (target < 0 || target > egptr() - eback()) return pos_type(off_type(-1));
+	setg(eback(), eback() + target, egptr());
+	return pos_type(target);
+}
+
+helpers::ViewStreamBuf::pos_type helpers::ViewStreamBuf::seekpos(const pos_type position, const std::ios_base::openmode which)
+{
+	return seekoff(off_type(position), std::ios_base::beg, which);
+}
+
+helpers::ViewStream::ViewStream(const std::string_view view): std::istream(nullptr), buffer(view)
+{
+	rdbuf(&buffer);
+}
@@ -0,0 +1,39 @@
+#ifndef VIEW_STREAM_H
+#define VIEW_STREAM_H
+
+#include <istream>
+#include <streambuf>
+#include <string_view>
+
+namespace helpers
+{
+	// A read-only stream buffer over memory we do not own (a mapped file, a string held
+	// elsewhere). Unlike std::istringstream it never copies its source.
+	class ViewStreamBuf: public std::streambuf
+	{
+	public:
+		explicit ViewStreamBuf(std::string_view view);
+
+		// Direct access to the unread part of the view, for scanners that can work on memory
+		// without going through the stream.
+		[[nodiscard]] std::string_view getRemaining() const { return std::string_view(gptr(), egptr() - gptr()); }
+		void consume(size_t count) { setg(eback(), gptr() + count, egptr()); }
+
+	protected:
+		pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override;
+		pos_type seekpos(pos_type position, std::ios_base::openmode which) override;
+	};
+
+	class ViewStream: public std::istream
+	{
+	public:
+		explicit ViewStream(std::string_view view);
+		ViewStream(const ViewStream&) = delete;
+		ViewStream& operator=(const ViewStream&) = delete;
+
+	private:
+		ViewStreamBuf buffer;
+	};
+}
+
+#endif // VIEW_STREAM_H
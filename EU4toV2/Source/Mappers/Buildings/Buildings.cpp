@@ -1,32 +1,14 @@
 #include "Buildings.h"
 #include "ParserHelpers.h"
 #include "../../Configuration.h"
-#include "OSCompatibilityLayer.h"
 
 mappers::Buildings::Buildings()
 {
 	registerKeys();
 
-	if (Utils::doesFolderExist(theConfiguration.getEU4Path() + "/common/buildings"))
+	for (const auto& filename : theConfiguration.getEU4Files().list("common/buildings"))
 	{
-		std::set<std::string> filenames;
-		Utils::GetAllFilesInFolder(theConfiguration.getEU4Path() + "/common/buildings/", filenames);
-		for (const auto& filename : filenames)
-		{
-			parseFile(theConfiguration.getEU4Path() + "/common/buildings/" + filename);
-		}
-	}
-	for (const auto& modName : theConfiguration.getEU4Mods())
-	{
-		if (Utils::doesFolderExist(modName + "/common/buildings"))
-		{
-			std::set<std::string> filenames;
-			Utils::GetAllFilesInFolder(modName + "/common/buildings/", filenames);
-			for (const auto& filename : filenames)
-			{
-				parseFile(modName + "/common/buildings/" + filename);
-			}
-		}
+		parseStream(*theConfiguration.getEU4Definitions().open(filename));
 	}
 	clearRegisteredKeywords();
 }
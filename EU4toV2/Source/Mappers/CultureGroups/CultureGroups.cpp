@@ -1,6 +1,5 @@
 #include "CultureGroups.h"
 #include "../../Configuration.h"
-#include "OSCompatibilityLayer.h"
 #include <set>
 #include "Log.h"
 #include "../CultureMapper/CultureMapper.h"
@@ -11,20 +10,9 @@ void mappers::CultureGroups::initForEU4()
 	LOG(LogLevel::Info) << "Parsing Cultures and Culture Groups";
 	registerKeys();
 
-	std::set<std::string> cultureFiles;
-	Utils::GetAllFilesInFolder(theConfiguration.getEU4Path() + "/common/cultures/", cultureFiles);
-	for (const auto& cultureFile : cultureFiles)
+	for (const auto& cultureFile : theConfiguration.getEU4Files().list("common/cultures"))
 	{
-		parseFile(theConfiguration.getEU4Path() + "/common/cultures/" + cultureFile);
-	}
-	for (const auto& itr: theConfiguration.getEU4Mods())
-	{
-		std::set<std::string> moreCultureFiles;
-		Utils::GetAllFilesInFolder(itr + "/common/cultures/", moreCultureFiles);
-		for (const auto& cultureFile: moreCultureFiles)
-		{
-			parseFile(itr + "/common/cultures/" + cultureFile);
-		}
+		parseStream(*theConfiguration.getEU4Definitions().open(cultureFile));
 	}
 	clearRegisteredKeywords();
 }
@@ -3,49 +3,52 @@
 #include "../../EU4World/Regions/Regions.h"
 #include "Log.h"
 
-mappers::CultureMappingRule::CultureMappingRule(std::istream& theStream)
+void mappers::CultureMappingRule::registerKeywords(helpers::KeywordTable<CultureMappingRule>& keywords)
 {
-	registerKeyword("vic2", [this](const std::string& unused, std::istream& theStream) 
+	keywords.registerKeyword("vic2", [](CultureMappingRule& rule, const std::string& unused, std::istream& theStream) 
 		{
 			const commonItems::singleString v2Str(theStream);
-			destinationCulture = v2Str.getString();
+			rule.destinationCulture = v2Str.getString();
 		});
-	registerKeyword("region", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("region", [](CultureMappingRule& rule, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString regionStr(theStream);
-			regions.insert(regionStr.getString());
+			rule.regions.insert(regionStr.getString());
 		});
-	registerKeyword("religion", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("religion", [](CultureMappingRule& rule, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString religionStr(theStream);
-			religions.insert(religionStr.getString());
+			rule.religions.insert(religionStr.getString());
 		});
-	registerKeyword("owner", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("owner", [](CultureMappingRule& rule, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString ownerStr(theStream);
-			owners.insert(ownerStr.getString());
+			rule.owners.insert(ownerStr.getString());
 		});
-	registerKeyword("provinceid", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("provinceid", [](CultureMappingRule& rule, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString provinceStr(theStream);
 			try
 			{
-				provinces.insert(stoi(provinceStr.getString()));
+				rule.provinces.insert(stoi(provinceStr.getString()));
 			}
 			catch (std::exception&)
 			{
 				Log(LogLevel::Warning) << "Invalid province ID in culture mapper: " << provinceStr.getString();
 			}
 		});
-	registerKeyword("eu4", [this](const std::string& unused, std::istream& theStream)
+	keywords.registerKeyword("eu4", [](CultureMappingRule& rule, const std::string& unused, std::istream& theStream)
 		{
 			const commonItems::singleString eu4Str(theStream);
-			cultures.insert(eu4Str.getString());
+			rule.cultures.insert(eu4Str.getString());
 		});
-	registerRegex("[a-zA-Z0-9\\_.:]+", commonItems::ignoreItem);
+	keywords.registerRegex("[a-zA-Z0-9\\_.:]+", commonItems::ignoreItem);
+}
 
-	parseStream(theStream);
-	clearRegisteredKeywords();
+mappers::CultureMappingRule::CultureMappingRule(std::istream& theStream)
+{
+	thread_local helpers::KeywordTable<CultureMappingRule> keywords(registerKeywords);
+	keywords.parse(*this, theStream);
 }
 
 mappers::CultureMappingRule::CultureMappingRule(const std::string& v2Culture, const std::string& eu4Culture, const std::string& eu4SuperRegion):
@@ -1,7 +1,7 @@
 #ifndef CULTURE_MAPPING_RULE_H
 #define CULTURE_MAPPING_RULE_H
 
-#include "newParser.h"
+#include "../../Helpers/KeywordTable.h"
 #include <set>
 
 namespace EU4 {
@@ -10,7 +10,7 @@ namespace EU4 {
 
 namespace mappers
 {
-	class CultureMappingRule: commonItems::parser
+	class CultureMappingRule
 	{
 	public:
 		CultureMappingRule() = default;
@@ -39,6 +39,8 @@ namespace mappers
 			const std::string& eu4ownerTag) const;
 
 	private:
+		static void registerKeywords(helpers::KeywordTable<CultureMappingRule>& keywords);
+
 		std::string destinationCulture;
 		std::set<std::string> cultures;
 		std::set<std::string> religions;
@@ -14,7 +14,7 @@ mappers::FactoryTechMapper::FactoryTechMapper()
 	Utils::GetAllFilesInFolder(theConfiguration.getVic2Path() + "/technologies/", filenames);
 	for (const auto& filename : filenames)
 	{
-		parseFile(theConfiguration.getVic2Path() + "/technologies/" + filename);
+		parseStream(*theConfiguration.getVic2Definitions().open(theConfiguration.getVic2Path() + "/technologies/" + filename));
 	}
 	clearRegisteredKeywords();
 }
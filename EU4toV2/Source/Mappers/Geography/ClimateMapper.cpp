@@ -2,6 +2,7 @@
 #include "ParserHelpers.h"
 #include "../../Configuration.h"
 #include "Log.h"
+#include <algorithm>
 
 mappers::ClimateMapper::ClimateMapper()
 {
@@ -9,6 +10,7 @@ mappers::ClimateMapper::ClimateMapper()
 	registerKeys();
 	parseFile(theConfiguration.getVic2Path() + "/map/climate.txt");
 	clearRegisteredKeywords();
+	indexProvinces();
 }
 
 mappers::ClimateMapper::ClimateMapper(std::istream& theStream)
@@ -16,6 +18,7 @@ mappers::ClimateMapper::ClimateMapper(std::istream& theStream)
 	registerKeys();
 	parseStream(theStream);
 	clearRegisteredKeywords();
+	indexProvinces();
 }
 
 void mappers::ClimateMapper::registerKeys()
@@ -47,3 +50,32 @@ void mappers::ClimateMapper::registerKeys()
 		});
 	registerRegex("[a-zA-Z0-9\\_.:]+", commonItems::ignoreItem);
 }
+
+void mappers::ClimateMapper::indexProvinces()
+{
+	auto maxProvinceID = -1;
+	for (const auto& climate: climateMap)
+		for (const auto provinceID: climate.second) maxProvinceID = std::max(maxProvinceID, provinceID);
+	climateByProvince.assign(static_cast<size_t>(maxProvinceID + 1), -1);
+
+	// A province listed under several climates gets the first of them, as lookups always did.
+	for (const auto& climate: climateMap)
+	{
+		const auto climateIndex = static_cast<int>(climateNames.size());
+		climateNames.push_back(climate.first);
+		for (const auto provinceID: climate.second)
+		{
+			if (provinceID < 0) continue;
+			auto& provinceClimate = climateByProvince[provinceID];
+			if (provinceClimate == -1) provinceClimate = climateIndex;
+		}
+	}
+}
+
+std::optional<std::string> mappers::ClimateMapper::getClimateForProvince(const int provinceID) const
+{
+	if (provinceID < 0 || static_cast<size_t>(provinceID) >= climateByProvince.size()) return std::nullopt;
+	const auto climateIndex = climateByProvince[provinceID];
+	if (climateIndex == -1) return std::nullopt;
+	return climateNames[climateIndex];
+}
@@ -3,6 +3,8 @@
 
 #include "newParser.h"
 #include <map>
+#include <optional>
+#include <vector>
 
 namespace mappers
 {
@@ -13,11 +15,15 @@ namespace mappers
 		explicit ClimateMapper(std::istream& theStream);
 		
 		[[nodiscard]] const auto& getClimateMap() const { return climateMap; }
+		[[nodiscard]] std::optional<std::string> getClimateForProvince(int provinceID) const;
 
 	private:
 		void registerKeys();
+		void indexProvinces();
 		
 		std::map<std::string, std::vector<int>> climateMap;
+		std::vector<std::string> climateNames;
+		std::vector<int> climateByProvince; // index into climateNames by province ID, -1 for none
 		bool mild_climate = false;
 		bool temperate_climate = false;
 		bool harsh_climate = false;
@@ -1,19 +1,22 @@
 #include "Continents.h"
 #include "../../Configuration.h"
 #include "Log.h"
-#include "OSCompatibilityLayer.h"
 #include "ParserHelpers.h"
 
 mappers::Continents::Continents()
 {
 	registerKeys();
 	LOG(LogLevel::Info) << "Finding Continents";
+	// Every mod's continents are merged, the game's are only read if no mod has any.
+	auto& definitions = theConfiguration.getEU4Definitions();
 	for (const auto& mod: theConfiguration.getEU4Mods())
 	{
-		const auto& continentFile = mod + "/map/continent.txt";
-		if (Utils::DoesFileExist(continentFile)) parseFile(continentFile);
+		if (const auto continentFile = definitions.tryOpen(mod + "/map/continent.txt")) parseStream(*continentFile);
+	}
+	if (continentMap.empty())
+	{
+		if (const auto continentFile = definitions.tryOpen(theConfiguration.getEU4Path() + "/map/continent.txt")) parseStream(*continentFile);
 	}
-	if (continentMap.empty()) parseFile(theConfiguration.getEU4Path() + "/map/continent.txt");
 	if (continentMap.empty()) LOG(LogLevel::Warning) << "No continent mappings found - may lead to problems later";
 	clearRegisteredKeywords();
 }
@@ -2,6 +2,9 @@
 #include "ProvinceMappingsVersion.h"
 #include "../../Configuration.h"
 #include "../../EU4World/EU4Version.h"
+#include "../../Helpers/ContentHash.h"
+#include "../../Helpers/MappedFile.h"
+#include "../../Helpers/ViewStream.h"
 #include "Log.h"
 #include <fstream>
 #include <stdexcept>
@@ -12,12 +15,27 @@ namespace fs = std::filesystem;
 mappers::ProvinceMapper::ProvinceMapper()
 {
 	LOG(LogLevel::Info) << "Parsing province mappings";
+	const helpers::MappedFile mappingsFile("configurables/province_mappings.txt");
+	if (!mappingsFile.isOpen()) throw std::runtime_error("Could not open configurables/province_mappings.txt");
+	auto mappingsText = mappingsFile.getView();
+	if (mappingsText.substr(0, 3) == "\xEF\xBB\xBF") mappingsText.remove_prefix(3);
+	helpers::ViewStream mappingsStream(mappingsText);
+
 	registerKeys();
-	parseFile("configurables/province_mappings.txt");
+	parseStream(mappingsStream);
 	clearRegisteredKeywords();
 
-	const auto& mappings = getMappingsVersion(mappingVersions, theConfiguration.getEU4Version());
-	createMappings(mappings);
+	// The tables are keyed by the text they were compiled from, so edited mappings get compiled anew.
+	const auto& [version, mappings] = getMappingsVersion(mappingVersions, theConfiguration.getEU4Version());
+	const auto tablesPath = "cache/province_mappings_" + helpers::ContentHash().update(mappings.getText()).toString() + ".tables";
+	mappingTables = ProvinceMappingTables::load(tablesPath);
+	if (!mappingTables)
+	{
+		helpers::ViewStream versionStream(mappings.getText());
+		mappingTables = std::make_unique<ProvinceMappingTables>(ProvinceMappingsVersion(version, versionStream));
+		mappingTables->save(tablesPath);
+	}
+	mappingVersions.clear();
 }
 
 mappers::ProvinceMapper::ProvinceMapper(std::istream& theStream, const Configuration& testConfiguration)
@@ -26,16 +44,19 @@ mappers::ProvinceMapper::ProvinceMapper(std::istream& theStream, const Configura
 	parseStream(theStream);
 	clearRegisteredKeywords();
 
-	const auto& mappings = getMappingsVersion(mappingVersions, testConfiguration.getEU4Version());
-	createMappings(mappings);
+	const auto& [version, mappings] = getMappingsVersion(mappingVersions, testConfiguration.getEU4Version());
+	helpers::ViewStream versionStream(mappings.getText());
+	mappingTables = std::make_unique<ProvinceMappingTables>(ProvinceMappingsVersion(version, versionStream));
+	mappingVersions.clear();
 }
 
 void mappers::ProvinceMapper::registerKeys()
 {
 	registerRegex("[0-9\\.]+", [this](const std::string& versionString, std::istream& theStream)
 		{
-			ProvinceMappingsVersion version(versionString, theStream);
-			mappingVersions.insert(std::make_pair(version.getVersion(), version));
+			// The file holds mappings for every EU4 version we support but only one is used, so the others
+			// are just skipped over here.
+			mappingVersions.insert(std::make_pair(EU4::Version(versionString), helpers::captureValue(theStream)));
 		});
 	registerRegex("[a-zA-Z0-9\\_.:]+", commonItems::ignoreItem);
 }
@@ -45,84 +66,34 @@ bool mappers::ProvinceMapper::provinceIsInRegion(int province, const std::string
 	return colonialRegionsMapper.provinceIsInRegion(province, region);
 }
 
-mappers::ProvinceMappingsVersion mappers::ProvinceMapper::getMappingsVersion(const std::map<EU4::Version, ProvinceMappingsVersion>& mappingsVersions, const EU4::Version& newVersion)
+const std::pair<const EU4::Version, helpers::RawBlock>& mappers::ProvinceMapper::getMappingsVersion(
+	const std::map<EU4::Version, helpers::RawBlock>& mappingsVersions,
+	const EU4::Version& newVersion)
 {
 	for (auto mappingsVersion = mappingsVersions.rbegin(); mappingsVersion != mappingsVersions.rend(); ++mappingsVersion)
 	{
 		if (newVersion >= mappingsVersion->first)
 		{
 			LOG(LogLevel::Info) << "\t-> Using version " << mappingsVersion->first << " mappings";
-			return mappingsVersion->second;
+			return *mappingsVersion;
 		}
 	}	
 	throw std::range_error("Could not find matching province mappings for EU4 version");
 }
 
-void mappers::ProvinceMapper::createMappings(const ProvinceMappingsVersion& provinceMappingsVersion)
-{
-	for (const auto& mapping: provinceMappingsVersion.getMappings())
-	{
-		// fix deliberate errors where we leave mappings without keys (asian wasteland comes to mind):
-		if (mapping.getVic2Provinces().empty()) continue;
-		if (mapping.getEU4Provinces().empty()) continue;
-		
-		for (const auto& vic2Number: mapping.getVic2Provinces())
-		{
-			if (vic2Number) vic2ToEU4ProvinceMap.insert(std::make_pair(vic2Number, mapping.getEU4Provinces()));
-		}
-		for (const auto& eu4Number: mapping.getEU4Provinces())
-		{
-			if (eu4Number) eu4ToVic2ProvinceMap.insert(std::make_pair(eu4Number, mapping.getVic2Provinces()));
-		}
-		for (const auto& resettableRegion: mapping.getResettableRegions())
-		{
-			addProvincesToResettableRegion(resettableRegion, mapping.getVic2Provinces());
-		}
-	}
-}
-
-void mappers::ProvinceMapper::addProvincesToResettableRegion(
-	const std::string& regionName,
-	const std::vector<int>& provinces
-) {
-	auto region = resettableProvinces.find(regionName);
-	if (region == resettableProvinces.end())
-	{
-		std::set<int> provincesSet;
-		for (const auto& province : provinces)
-		{
-			provincesSet.insert(province);
-		}
-		resettableProvinces.insert(std::make_pair(regionName, provincesSet));
-	}
-	else
-	{
-		for (const auto& province: provinces)
-		{
-			region->second.insert(province);
-		}
-	}
-}
-
-std::vector<int> mappers::ProvinceMapper::getVic2ProvinceNumbers(const int eu4ProvinceNumber) const
+helpers::Span<const int> mappers::ProvinceMapper::getVic2ProvinceNumbers(const int eu4ProvinceNumber) const
 {
-	const auto& mapping = eu4ToVic2ProvinceMap.find(eu4ProvinceNumber);
-	if (mapping != eu4ToVic2ProvinceMap.end()) return mapping->second;
-	return std::vector<int>();
+	return mappingTables->getVic2ProvinceNumbers(eu4ProvinceNumber);
 }
 
-std::vector<int> mappers::ProvinceMapper::getEU4ProvinceNumbers(int vic2ProvinceNumber) const
+helpers::Span<const int> mappers::ProvinceMapper::getEU4ProvinceNumbers(const int vic2ProvinceNumber) const
 {
-	const auto& mapping = vic2ToEU4ProvinceMap.find(vic2ProvinceNumber);
-	if (mapping != vic2ToEU4ProvinceMap.end()) return mapping->second;
-	return std::vector<int>();
+	return mappingTables->getEU4ProvinceNumbers(vic2ProvinceNumber);
 }
 
-bool mappers::ProvinceMapper::isProvinceResettable(int vic2ProvinceNumber, const std::string& region) const
+bool mappers::ProvinceMapper::isProvinceResettable(const int vic2ProvinceNumber, const std::string& region) const
 {
-	const auto& regionProvinces = resettableProvinces.find(region);
-	if (regionProvinces == resettableProvinces.end()) return false;
-	return regionProvinces->second.count(vic2ProvinceNumber) > 0;
+	return mappingTables->isProvinceResettable(vic2ProvinceNumber, region);
 }
 
 void mappers::ProvinceMapper::determineValidProvinces()
@@ -2,10 +2,14 @@
 #define PROVINCE_MAPPER_H
 
 #include "ProvinceMappingsVersion.h"
+#include "ProvinceMappingTables.h"
 #include "../../EU4World/ColonialRegions/ColonialRegions.h"
 #include "../../Configuration.h"
+#include "../../Helpers/RawBlocks.h"
+#include "../../Helpers/Span.h"
 #include "newParser.h"
 #include <map>
+#include <memory>
 #include <set>
 
 namespace EU4
@@ -21,25 +25,24 @@ namespace mappers
 		ProvinceMapper();
 		explicit ProvinceMapper(std::istream& theStream, const Configuration& testConfiguration);
 
-		[[nodiscard]] std::vector<int> getVic2ProvinceNumbers(int eu4ProvinceNumber) const;
-		[[nodiscard]] std::vector<int> getEU4ProvinceNumbers(int vic2ProvinceNumber) const;
+		// Views into the mapper's tables, valid for as long as the mapper is.
+		[[nodiscard]] helpers::Span<const int> getVic2ProvinceNumbers(int eu4ProvinceNumber) const;
+		[[nodiscard]] helpers::Span<const int> getEU4ProvinceNumbers(int vic2ProvinceNumber) const;
 		[[nodiscard]] bool isProvinceResettable(int vic2ProvinceNumber, const std::string& region) const;
 		[[nodiscard]] bool provinceIsInRegion(int province, const std::string& region) const;
 		[[nodiscard]] auto isValidProvince(const int province) const { return validProvinces.count(province) > 0; }
 
 	private:
 		void registerKeys();
-		static ProvinceMappingsVersion getMappingsVersion(const std::map<EU4::Version, ProvinceMappingsVersion>& mappingsVersions, const EU4::Version& newVersion);
-		void createMappings(const ProvinceMappingsVersion& provinceMappingsVersion);
-		void addProvincesToResettableRegion(const std::string& regionName, const std::vector<int>& provinces);
+		[[nodiscard]] static const std::pair<const EU4::Version, helpers::RawBlock>& getMappingsVersion(
+			const std::map<EU4::Version, helpers::RawBlock>& mappingsVersions,
+			const EU4::Version& newVersion);
 		void determineValidProvinces();
 
-		std::map<int, std::vector<int>> vic2ToEU4ProvinceMap;
-		std::map<int, std::vector<int>> eu4ToVic2ProvinceMap;
-		std::map<std::string, std::set<int>> resettableProvinces;
+		std::unique_ptr<ProvinceMappingTables> mappingTables;
 		std::set<int> validProvinces;
 		EU4::ColonialRegions colonialRegionsMapper;
-		std::map<EU4::Version, ProvinceMappingsVersion> mappingVersions;
+		std::map<EU4::Version, helpers::RawBlock> mappingVersions; // unparsed, only needed while constructing
 	};
 }
 
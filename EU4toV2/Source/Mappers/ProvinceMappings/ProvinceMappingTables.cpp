@@ -0,0 +1,214 @@
+#include "ProvinceMappingTables.h"
+#include "ProvinceMappingsVersion.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <set>
+namespace fs = std::filesystem;
+
+namespace
+{
+	// Bump FORMAT_VERSION whenever the layout changes, older files are then compiled anew.
+	constexpr int32_t MAGIC = 0x32563445; // "E4V2"
+	constexpr int32_t FORMAT_VERSION = 1;
+
+	// The image starts with these words, followed by the EU4 to Vic2 offsets and values, the Vic2
+	// to EU4 offsets and values, the region bitsets one after another and finally the region
+	// names, each ended by a zero byte and padded to a whole word.
+	enum HeaderWord
+	{
+		magicWord,
+		formatWord,
+		eu4KeyCountWord,
+		eu4ValueCountWord,
+		vic2KeyCountWord,
+		vic2ValueCountWord,
+		regionCountWord,
+		regionWordCountWord,
+		nameWordCountWord,
+		headerSize
+	};
+
+	using Targets = std::vector<const std::vector<int>*>; // provinces mapped to, by province number
+
+	// The first link naming a province wins, as it did when the mappings were kept in maps.
+	void addTarget(Targets& targets, const int provinceNumber, const std::vector<int>& provinces)
+	{
+		if (provinceNumber <= 0) return;
+		if (static_cast<size_t>(provinceNumber) >= targets.size()) targets.resize(provinceNumber + 1, nullptr);
+		if (!targets[provinceNumber]) targets[provinceNumber] = &provinces;
+	}
+
+	int32_t appendTable(std::vector<int32_t>& image, const Targets& targets)
+	{
+		int32_t offset = 0;
+		for (const auto* target: targets)
+		{
+			image.push_back(offset);
+			if (target) offset += static_cast<int32_t>(target->size());
+		}
+		image.push_back(offset);
+		for (const auto* target: targets)
+		{
+			if (target) image.insert(image.end(), target->begin(), target->end());
+		}
+		return offset;
+	}
+}
+
+mappers::ProvinceMappingTables::ProvinceMappingTables(const ProvinceMappingsVersion& provinceMappingsVersion)
+{
+	Targets eu4ToVic2Targets;
+	Targets vic2ToEU4Targets;
+	std::map<std::string, std::set<int>> regionProvinces;
+	auto highestRegionProvince = -1;
+	for (const auto& mapping: provinceMappingsVersion.getMappings())
+	{
+		// fix deliberate errors where we leave mappings without keys (asian wasteland comes to mind):
+		if (mapping.getVic2Provinces().empty()) continue;
+		if (mapping.getEU4Provinces().empty()) continue;
+
+		for (const auto& eu4Number: mapping.getEU4Provinces()) addTarget(eu4ToVic2Targets, eu4Number, mapping.getVic2Provinces());
+		for (const auto& vic2Number: mapping.getVic2Provinces()) addTarget(vic2ToEU4Targets, vic2Number, mapping.getEU4Provinces());
+		for (const auto& resettableRegion: mapping.getResettableRegions())
+		{
+			for (const auto& vic2Number: mapping.getVic2Provinces())
+			{
+				if (vic2Number < 0) continue;
+				regionProvinces[resettableRegion].insert(vic2Number);
+				highestRegionProvince = std::max(highestRegionProvince, vic2Number);
+			}
+		}
+	}
+
+	image.resize(headerSize);
+	image[magicWord] = MAGIC;
+	image[formatWord] = FORMAT_VERSION;
+	image[eu4KeyCountWord] = static_cast<int32_t>(eu4ToVic2Targets.size());
+	image[eu4ValueCountWord] = appendTable(image, eu4ToVic2Targets);
+	image[vic2KeyCountWord] = static_cast<int32_t>(vic2ToEU4Targets.size());
+	image[vic2ValueCountWord] = appendTable(image, vic2ToEU4Targets);
+
+	const auto bitsetWords = static_cast<size_t>(highestRegionProvince + 32) / 32;
+	image[regionCountWord] = static_cast<int32_t>(regionProvinces.size());
+	image[regionWordCountWord] = static_cast<int32_t>(bitsetWords);
+	for (const auto& region: regionProvinces)
+	{
+		const auto bitset = image.size();
+		image.resize(bitset + bitsetWords, 0);
+		for (const auto province: region.second)
+		{
+			image[bitset + province / 32] = static_cast<int32_t>(static_cast<uint32_t>(image[bitset + province / 32]) | 1u << (province % 32));
+		}
+	}
+
+	std::string names;
+	for (const auto& region: regionProvinces)
+	{
+		names += region.first;
+		names.append(sizeof(int32_t) - region.first.size() % sizeof(int32_t), '\0');
+	}
+	image[nameWordCountWord] = static_cast<int32_t>(names.size() / sizeof(int32_t));
+	const auto namesStart = image.size();
+	image.resize(namesStart + names.size() / sizeof(int32_t));
+	std::memcpy(image.data() + namesStart, names.data(), names.size());
+
+	index(image.data(), image.size());
+}
+
+std::unique_ptr<mappers::ProvinceMappingTables> mappers::ProvinceMappingTables::load(const std::string& path)
+{
+	std::unique_ptr<ProvinceMappingTables> tables(new ProvinceMappingTables());
+	tables->mappedImage = std::make_unique<helpers::MappedFile>(path);
+	if (!tables->mappedImage->isOpen()) return nullptr;
+
+	const auto view = tables->mappedImage->getView();
+	if (view.size() % sizeof(int32_t)) return nullptr;
+	// Mappings start on a page boundary, so the words are aligned.
+	if (!tables->index(reinterpret_cast<const int32_t*>(view.data()), view.size() / sizeof(int32_t))) return nullptr;
+	return tables;
+}
+
+void mappers::ProvinceMappingTables::save(const std::string& path) const
+{
+	std::error_code error;
+	fs::create_directories(fs::u8path(path).parent_path(), error);
+	// Unique, so converters sharing the cache never write into the same file.
+	const auto temporaryPath = path + ".tmp" + std::to_string(std::random_device()());
+	std::ofstream file(fs::u8path(temporaryPath), std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(words), static_cast<std::streamsize>(wordCount * sizeof(int32_t)));
+	file.close();
+
+	if (!file.fail()) fs::rename(fs::u8path(temporaryPath), fs::u8path(path), error);
+	if (file.fail() || error) fs::remove(fs::u8path(temporaryPath), error);
+}
+
+bool mappers::ProvinceMappingTables::isProvinceResettable(const int vic2ProvinceNumber, const std::string& region) const
+{
+	const auto& bitset = resettableRegions.find(region);
+	if (bitset == resettableRegions.end()) return false;
+	if (vic2ProvinceNumber < 0 || static_cast<size_t>(vic2ProvinceNumber) / 32 >= regionWordCount) return false;
+	return (static_cast<uint32_t>(bitset->second[vic2ProvinceNumber / 32]) >> (vic2ProvinceNumber % 32) & 1u) != 0;
+}
+
+helpers::Span<const int> mappers::ProvinceMappingTables::Table::lookup(const int provinceNumber) const
+{
+	if (provinceNumber < 0 || static_cast<size_t>(provinceNumber) >= keyCount) return helpers::Span<const int>();
+	return helpers::Span<const int>(values + offsets[provinceNumber], offsets[provinceNumber + 1] - offsets[provinceNumber]);
+}
+
+bool mappers::ProvinceMappingTables::index(const int32_t* theWords, const size_t theWordCount)
+{
+	if (theWordCount < headerSize || theWords[magicWord] != MAGIC || theWords[formatWord] != FORMAT_VERSION) return false;
+
+	// Every count comes from a file that may be damaged, so each part is checked to fit before it is used.
+	size_t position = headerSize;
+	const auto count = [theWords](const HeaderWord word) { return static_cast<size_t>(static_cast<uint32_t>(theWords[word])); };
+	const auto take = [theWords, theWordCount, &position](const size_t size) -> const int32_t* {
+		if (size > theWordCount - position) return nullptr;
+		position += size;
+		return theWords + position - size;
+	};
+	const auto readTable = [&take](Table& table, const size_t keyCount, const size_t valueCount) {
+		table.keyCount = keyCount;
+		table.offsets = take(keyCount + 1);
+		table.values = take(valueCount);
+		if (!table.offsets || !table.values || table.offsets[0] != 0) return false;
+		for (size_t key = 0; key < keyCount; ++key)
+		{
+			if (table.offsets[key + 1] < table.offsets[key]) return false;
+		}
+		return static_cast<size_t>(table.offsets[keyCount]) == valueCount;
+	};
+	if (!readTable(eu4ToVic2, count(eu4KeyCountWord), count(eu4ValueCountWord))) return false;
+	if (!readTable(vic2ToEU4, count(vic2KeyCountWord), count(vic2ValueCountWord))) return false;
+
+	const auto regionCount = count(regionCountWord);
+	regionWordCount = count(regionWordCountWord);
+	std::vector<const int32_t*> bitsets;
+	for (size_t region = 0; region < regionCount; ++region)
+	{
+		const auto* bitset = take(regionWordCount);
+		if (!bitset) return false;
+		bitsets.push_back(bitset);
+	}
+
+	const auto nameWordCount = count(nameWordCountWord);
+	const auto* nameWords = take(nameWordCount);
+	if (!nameWords || position != theWordCount) return false;
+	std::string_view names(reinterpret_cast<const char*>(nameWords), nameWordCount * sizeof(int32_t));
+	for (const auto* bitset: bitsets)
+	{
+		const auto nameEnd = names.find('\0');
+		if (nameEnd == std::string_view::npos) return false;
+		resettableRegions.insert(std::make_pair(std::string(names.substr(0, nameEnd)), bitset));
+		names.remove_prefix((nameEnd / sizeof(int32_t) + 1) * sizeof(int32_t));
+	}
+	if (!names.empty() || resettableRegions.size() != regionCount) return false;
+
+	words = theWords;
+	wordCount = theWordCount;
+	return true;
+}
@@ -0,0 +1,63 @@
+#ifndef PROVINCE_MAPPING_TABLES_H
+#define PROVINCE_MAPPING_TABLES_H
+
+#include "../../Helpers/MappedFile.h"
+#include "../../Helpers/Span.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mappers
+{
+	class ProvinceMappingsVersion;
+
+	// The links of one province mappings version compiled into flat tables. For either direction
+	// there is one offset per province number into a single array of mapped provinces, and every
+	// resettable region is a bitset over Vic2 province numbers. All of it is one block of 32-bit
+	// words that is written to disk as it is, so a later run maps the file and uses it in place.
+	class ProvinceMappingTables
+	{
+	public:
+		explicit ProvinceMappingTables(const ProvinceMappingsVersion& provinceMappingsVersion);
+		ProvinceMappingTables(const ProvinceMappingTables&) = delete;
+		ProvinceMappingTables(ProvinceMappingTables&&) = delete;
+		ProvinceMappingTables& operator=(const ProvinceMappingTables&) = delete;
+		ProvinceMappingTables& operator=(ProvinceMappingTables&&) = delete;
+
+		// Tables saved by an earlier run, or nullptr if the file is missing, from another format or damaged.
+		[[nodiscard]] static std::unique_ptr<ProvinceMappingTables> load(const std::string& path);
+		void save(const std::string& path) const;
+
+		// Views into the tables, valid as long as they are.
+		[[nodiscard]] helpers::Span<const int> getVic2ProvinceNumbers(int eu4ProvinceNumber) const { return eu4ToVic2.lookup(eu4ProvinceNumber); }
+		[[nodiscard]] helpers::Span<const int> getEU4ProvinceNumbers(int vic2ProvinceNumber) const { return vic2ToEU4.lookup(vic2ProvinceNumber); }
+		[[nodiscard]] bool isProvinceResettable(int vic2ProvinceNumber, const std::string& region) const;
+
+	private:
+		struct Table
+		{
+			const int32_t* offsets = nullptr; // keyCount + 1 of them, into values
+			const int32_t* values = nullptr;
+			size_t keyCount = 0;
+
+			[[nodiscard]] helpers::Span<const int> lookup(int provinceNumber) const;
+		};
+
+		ProvinceMappingTables() = default;
+		bool index(const int32_t* words, size_t wordCount);
+
+		std::vector<int32_t> image; // the tables when compiled in this run
+		std::unique_ptr<helpers::MappedFile> mappedImage; // or when loaded from disk
+		const int32_t* words = nullptr;
+		size_t wordCount = 0;
+
+		Table eu4ToVic2;
+		Table vic2ToEU4;
+		std::map<std::string, const int32_t*> resettableRegions; // region name, bitset
+		size_t regionWordCount = 0; // per bitset
+	};
+}
+
+#endif // PROVINCE_MAPPING_TABLES_H
@@ -1,7 +1,12 @@
 #include "ProvinceMappingsVersion.h"
 #include "ParserHelpers.h"
 
-mappers::ProvinceMappingsVersion::ProvinceMappingsVersion(const std::string& versionString, std::istream& theStream)
+mappers::ProvinceMappingsVersion::ProvinceMappingsVersion(const std::string& versionString, std::istream& theStream):
+	ProvinceMappingsVersion(EU4::Version(versionString), theStream)
+{
+}
+
+mappers::ProvinceMappingsVersion::ProvinceMappingsVersion(EU4::Version theVersion, std::istream& theStream): version(std::move(theVersion))
 {
 	registerKeyword("link", [this](const std::string& unused, std::istream& theStream)
 		{
@@ -12,6 +17,4 @@ mappers::ProvinceMappingsVersion::ProvinceMappingsVersion(const std::string& ver
 	
 	parseStream(theStream);
 	clearRegisteredKeywords();
-
-	version = EU4::Version(versionString);
 }
\ No newline at end of file
@@ -11,6 +11,7 @@ namespace mappers
 	{
 	public:
 		ProvinceMappingsVersion(const std::string& versionString, std::istream& theStream);
+		ProvinceMappingsVersion(EU4::Version theVersion, std::istream& theStream);
 
 		[[nodiscard]] const auto& getVersion() const { return version; }
 		[[nodiscard]] const auto& getMappings() const { return mappings; }
@@ -1,30 +1,36 @@
 #ifndef REGION_LOCALIZATIONS_H
 #define REGION_LOCALIZATIONS_H
 
-#include <map>
 #include <string>
 #include <optional>
 
+namespace EU4
+{
+	class EU4Localisation;
+}
+
 namespace mappers
 {
+	// Area and region names for neo-culture localisation, looked up in the localisation
+	// index the EU4 world already loaded. Unlike when these names were read from the install's
+	// l_<language> files by hand, the language comes from each file's "l_<language>:" header,
+	// mods are read too and a later file overrides an earlier one, and a name ends at its
+	// first closing quote, as for all other EU4 localisation.
 	class RegionLocalizations
 	{
 	public:
-		RegionLocalizations();
+		explicit RegionLocalizations(const EU4::EU4Localisation& theLocalisation): localisation(theLocalisation) {}
 
-		[[nodiscard]] std::optional<std::string> getEnglishFor(const std::string& key);
-		[[nodiscard]] std::optional<std::string> getFrenchFor(const std::string& key);
-		[[nodiscard]] std::optional<std::string> getSpanishFor(const std::string& key);
-		[[nodiscard]] std::optional<std::string> getGermanFor(const std::string& key);
+		[[nodiscard]] std::optional<std::string> getEnglishFor(const std::string& key) const;
+		[[nodiscard]] std::optional<std::string> getFrenchFor(const std::string& key) const;
+		[[nodiscard]] std::optional<std::string> getSpanishFor(const std::string& key) const;
+		[[nodiscard]] std::optional<std::string> getGermanFor(const std::string& key) const;
 
 	private:
-		std::map<std::string, std::string> spaLocalisations; // key, localization_text
-		std::map<std::string, std::string> engLocalisations;
-		std::map<std::string, std::string> gerLocalisations;
-		std::map<std::string, std::string> fraLocalisations;
+		[[nodiscard]] std::optional<std::string> getTextFor(const std::string& key, const std::string& language) const;
 
-		std::map<std::string, std::string> chopFile(const std::string& locFile) const;
+		const EU4::EU4Localisation& localisation;
 	};
 }
 
-#endif // REGION_LOCALIZATIONS_H
\ No newline at end of file
+#endif // REGION_LOCALIZATIONS_H
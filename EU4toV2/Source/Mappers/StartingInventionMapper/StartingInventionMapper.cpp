@@ -14,7 +14,7 @@ mappers::StartingInventionMapper::StartingInventionMapper()
 	Utils::GetAllFilesInFolder(theConfiguration.getVic2Path() + "/inventions/", filenames);
 	for (const auto& filename : filenames)
 	{
-		parseFile(theConfiguration.getVic2Path() + "/inventions/" + filename);
+		parseStream(*theConfiguration.getVic2Definitions().open(theConfiguration.getVic2Path() + "/inventions/" + filename));
 	}
 	clearRegisteredKeywords();
 }
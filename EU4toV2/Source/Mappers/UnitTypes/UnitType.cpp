@@ -1,5 +1,6 @@
 #include "UnitType.h"
 #include "ParserHelpers.h"
+#include "../../Configuration.h"
 
 mappers::UnitType::UnitType(std::istream& theStream)
 {
@@ -11,7 +12,7 @@ mappers::UnitType::UnitType(std::istream& theStream)
 mappers::UnitType::UnitType(const std::string& filePath)
 {
 	registerKeys();
-	parseFile(filePath);
+	parseStream(*theConfiguration.getEU4Definitions().open(filePath));
 	clearRegisteredKeywords();
 }
 
@@ -1,8 +1,6 @@
 #include "UnitTypeMapper.h"
 #include "ParserHelpers.h"
 #include "Log.h"
-#include <set>
-#include "OSCompatibilityLayer.h"
 #include "../../Configuration.h"
 
 
@@ -10,21 +8,10 @@ void mappers::UnitTypeMapper::initUnitTypeMapper()
 {
 	LOG(LogLevel::Info) << "Parsing unit strengths from EU4 installation.";
 
-	std::set<std::string> filenames;
-	Utils::GetAllFilesInFolder(theConfiguration.getEU4Path() + "/common/units/", filenames);
-	for (const auto& filename : filenames)
+	for (const auto& fullFilename : theConfiguration.getEU4Files().list("common/units"))
 	{
-		addUnitFileToRegimentTypeMap(theConfiguration.getEU4Path() + "/common/units", filename);
-	}
-
-	for (const auto& modName : theConfiguration.getEU4Mods())
-	{
-		std::set<std::string> moreFilenames;
-		Utils::GetAllFilesInFolder(modName + "/common/units/", moreFilenames);
-		for (const auto& filename : moreFilenames)
-		{
-			addUnitFileToRegimentTypeMap(modName + "/common/units", filename);
-		}
+		const auto lastPathSeparatorPos = fullFilename.find_last_of('/');
+		addUnitFileToRegimentTypeMap(fullFilename.substr(0, lastPathSeparatorPos), fullFilename.substr(lastPathSeparatorPos + 1));
 	}
 }
 
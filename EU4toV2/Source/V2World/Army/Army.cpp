@@ -63,6 +63,7 @@ V2::Army::Army(const EU4::EU4Army& eu4Army,
 	// Place the army somewhere.
 
 	auto locationCandidates = provinceMapper.getVic2ProvinceNumbers(eu4Army.getLocation());
+	std::vector<int> portCandidates;
 	if (locationCandidates.empty())
 	{
 		Log(LogLevel::Warning) << "no mapping for province : " << eu4Army.getLocation();
@@ -94,7 +95,8 @@ V2::Army::Army(const EU4::EU4Army& eu4Army,
 		if (provinceItr != allProvinces.end()) usePort = true; // It's in land provinces, so docked.
 		if (usePort)
 		{
-			locationCandidates = getPortProvinces(locationCandidates, allProvinces, portProvincesMapper);
+			portCandidates = getPortProvinces(locationCandidates, allProvinces, portProvincesMapper);
+			locationCandidates = portCandidates;
 			if (locationCandidates.empty())
 			{
 				// We have a navy and no port candidates. Yay. Better get rid of it.
@@ -172,6 +174,7 @@ V2::AddRegimentToArmyResult V2::Army::addRegimentToArmy(
 
 	// Map the home to V2 province
 	auto homeCandidates = provinceMapper.getVic2ProvinceNumbers(*eu4Home);
+	std::vector<int> portCandidates;
 	if (homeCandidates.empty())
 	{
 		// This was a province that doesn't map to anything. Let's pretend that's fine and there's
@@ -186,7 +189,8 @@ V2::AddRegimentToArmyResult V2::Army::addRegimentToArmy(
 	if (isNavy)
 	{
 		// Navies should only get homes in port provinces
-		homeCandidates = getPortProvinces(homeCandidates, allProvinces, portProvincesMapper);
+		portCandidates = getPortProvinces(homeCandidates, allProvinces, portProvincesMapper);
+		homeCandidates = portCandidates;
 		if (!homeCandidates.empty()) homeProvince = pickRandomPortProvince(homeCandidates, allProvinces);
 		// else: So far nothing. No berth.
 	}
@@ -286,7 +290,7 @@ std::optional<int> V2::Army::getProbabilisticHomeProvince(const REGIMENTTYPE cho
 	return *randomProvince.begin();
 }
 
-std::shared_ptr<V2::Province> V2::Army::pickRandomPortProvince(const std::vector<int>& homeCandidates, const std::map<int, std::shared_ptr<Province>>& allProvinces)
+std::shared_ptr<V2::Province> V2::Army::pickRandomPortProvince(const helpers::Span<const int> homeCandidates, const std::map<int, std::shared_ptr<Province>>& allProvinces)
 {
 	std::set<int> randomProvince;
 	std::sample(homeCandidates.begin(), homeCandidates.end(), std::inserter(randomProvince, randomProvince.begin()), 1, std::mt19937{ std::random_device{}() });
@@ -296,7 +300,7 @@ std::shared_ptr<V2::Province> V2::Army::pickRandomPortProvince(const std::vector
 	return nullptr;
 }
 
-int V2::Army::pickRandomProvinceID(std::vector<int> homeCandidates)
+int V2::Army::pickRandomProvinceID(const helpers::Span<const int> homeCandidates)
 {
 	std::set<int> randomProvince;
 	std::sample(homeCandidates.begin(), homeCandidates.end(), std::inserter(randomProvince, randomProvince.begin()), 1, std::mt19937{ std::random_device{}() });
@@ -314,19 +318,14 @@ void V2::Army::blockHomeProvince(const int blocked)
 }
 
 std::vector<int> V2::Army::getPortProvinces(
-	const std::vector<int>& locationCandidates,
-	std::map<int, std::shared_ptr<Province>> allProvinces,
+	const helpers::Span<const int> locationCandidates,
+	const std::map<int, std::shared_ptr<Province>>& allProvinces,
 	const mappers::PortProvinces& portProvincesMapper)
 {
-	std::vector<int> unblockedCandidates;
-	for (auto candidate : locationCandidates)
-	{
-		if (!portProvincesMapper.isProvinceIDBlacklisted(candidate)) unblockedCandidates.push_back(candidate);
-	}
-
 	std::vector<int> coastalProvinces;
-	for (auto& candidate : unblockedCandidates)
+	for (auto candidate : locationCandidates)
 	{
+		if (portProvincesMapper.isProvinceIDBlacklisted(candidate)) continue;
 		auto province = allProvinces.find(candidate);
 		if (province != allProvinces.end())
 		{
@@ -44,8 +44,8 @@ namespace V2
 			const std::string& localAdjective);
 
 		static std::vector<int> getPortProvinces(
-			const std::vector<int>& locationCandidates,
-			std::map<int, std::shared_ptr<Province>> allProvinces,
+			helpers::Span<const int> locationCandidates,
+			const std::map<int, std::shared_ptr<Province>>& allProvinces,
 			const mappers::PortProvinces& portProvincesMapper);
 
 	private:
@@ -53,11 +53,11 @@ namespace V2
 		void blockHomeProvince(int blocked);
 
 		static REGIMENTTYPE pickCategory(EU4::REGIMENTCATEGORY incCategory, bool civilized);
-		static std::shared_ptr<Province> pickRandomPortProvince(const std::vector<int>& homeCandidates, const std::map<int, std::shared_ptr<Province>>& allProvinces);
+		static std::shared_ptr<Province> pickRandomPortProvince(helpers::Span<const int> homeCandidates, const std::map<int, std::shared_ptr<Province>>& allProvinces);
 		static bool provinceRegimentCapacityPredicate(std::shared_ptr<Province> prov1, std::shared_ptr<Province> prov2);
 		static std::shared_ptr<Province> getProvinceForExpeditionaryArmy(const std::map<int, std::shared_ptr<Province>>& allProvinces, const std::string& tag);
 		static std::string getRegimentName(REGIMENTTYPE chosenType, std::map<REGIMENTTYPE, int>& unitNameCount, const std::string& localAdjective);
-		static int pickRandomProvinceID(std::vector<int> homeCandidates);
+		static int pickRandomProvinceID(helpers::Span<const int> homeCandidates);
 				
 		std::string name;
 		int location = 0;
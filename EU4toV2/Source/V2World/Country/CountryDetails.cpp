@@ -1,28 +1,29 @@
 #include "CountryDetails.h"
 #include "ParserHelpers.h"
-#include "OSCompatibilityLayer.h"
+#include "Log.h"
 #include "../../Configuration.h"
 
 V2::CountryDetails::CountryDetails(std::string _filename): filename(std::move(_filename))
 {
 	registerKeys();
 
-	if (Utils::DoesFileExist("./blankMod/output/common/countries/" + filename))
+	auto& definitions = theConfiguration.getVic2Definitions();
+	if (const auto countryFile = definitions.tryOpen("./blankMod/output/common/countries/" + filename))
 	{
-		parseFile("./blankMod/output/common/countries/" + filename);
+		parseStream(*countryFile);
 	}
-	else if (Utils::DoesFileExist(theConfiguration.getVic2Path() + "/common/countries/" + filename))
+	else if (const auto vanillaCountryFile = definitions.tryOpen(theConfiguration.getVic2Path() + "/common/countries/" + filename))
 	{
-		parseFile(theConfiguration.getVic2Path() + "/common/countries/" + filename);
+		parseStream(*vanillaCountryFile);
 	}
 	// Maybe we're initializing a dead nation. If so look in the /other/ place.
-	else if (Utils::DoesFileExist("./blankMod/output/history/countries/" + filename))
+	else if (const auto historyFile = definitions.tryOpen("./blankMod/output/history/countries/" + filename))
 	{
-		parseFile("./blankMod/output/history/countries/" + filename);
+		parseStream(*historyFile);
 	}
-	else if (Utils::DoesFileExist(theConfiguration.getVic2Path() + "/history/countries/" + filename))
+	else if (const auto vanillaHistoryFile = definitions.tryOpen(theConfiguration.getVic2Path() + "/history/countries/" + filename))
 	{
-		parseFile(theConfiguration.getVic2Path() + "/history/countries/" + filename);
+		parseStream(*vanillaHistoryFile);
 	}
 	else
 	{
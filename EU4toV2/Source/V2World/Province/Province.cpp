@@ -1,5 +1,4 @@
 #include "Province.h"
-#include "OSCompatibilityLayer.h"
 #include "../../Configuration.h"
 #include "../Country/Country.h"
 #include <cmath>
@@ -27,23 +26,17 @@ filename(std::move(_filename))
 	provinceID = stoi(temp);
 
 	//In case we're overriding provinces (not true by default)
-	if (Utils::DoesFileExist("./blankMod/output/history/provinces" + filename))
+	auto& definitions = theConfiguration.getVic2Definitions();
+	if (const auto overrideFile = definitions.tryOpen("./blankMod/output/history/provinces" + filename))
 	{
-		details = mappers::ProvinceDetails("./blankMod/output/history/provinces" + filename);
+		details = mappers::ProvinceDetails(*overrideFile);
 	}
 	else
 	{
-		details = mappers::ProvinceDetails(theConfiguration.getVic2Path() + "/history/provinces" + filename);
+		details = mappers::ProvinceDetails(*definitions.open(theConfiguration.getVic2Path() + "/history/provinces" + filename));
 	}
 
-	for (const auto& climate : climateMapper.getClimateMap())
-	{
-		if (count(climate.second.begin(), climate.second.end(), provinceID))
-		{
-			details.climate = climate.first;
-			break;
-		}
-	}
+	if (const auto climate = climateMapper.getClimateForProvince(provinceID)) details.climate = *climate;
 
 	if (details.terrain.empty())
 	{
@@ -162,7 +155,7 @@ void V2::Province::convertFromOldProvince(
 	for (const auto& oldProvince : provinceSources)
 		for (const auto& core : oldProvince->getCores())
 		{
-			auto potentialCore = countryMapper.getV2Tag(core);
+			auto potentialCore = countryMapper.getV2Tag(core.getString());
 			if (potentialCore) addCore(*potentialCore);
 		}
 
@@ -9,6 +9,7 @@
 #include "../Mappers/TechGroups/TechGroupsMapper.h"
 #include "../EU4World/World.h"
 #include "../Helpers/TechValues.h"
+#include "../Helpers/ThreadPool.h"
 #include "Flags/Flags.h"
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -20,7 +21,8 @@ V2::World::World(const EU4::World& sourceWorld,
 	const mappers::IdeaEffectMapper& ideaEffectMapper, 
 	const mappers::TechGroupsMapper& techGroupsMapper, 
 	const mappers::VersionParser& versionParser):
-historicalData(sourceWorld.getHistoricalData())
+historicalData(sourceWorld.getHistoricalData()),
+regionLocalizations(sourceWorld.getLocalisation())
 {
 	LOG(LogLevel::Info) << "*** Hello Vicky 2, creating world. ***";
 	LOG(LogLevel::Info) << "-> Importing Provinces";
@@ -86,6 +88,10 @@ historicalData(sourceWorld.getHistoricalData())
 	LOG(LogLevel::Info) << "-> Converting Botanical Definitions";
 	transcribeHistoricalData();
 
+	// Mappers built for the Vic2 world read EU4 files too, so neither pack is saved any earlier.
+	theConfiguration.getEU4Definitions().save();
+	theConfiguration.getVic2Definitions().save();
+
 	LOG(LogLevel::Info) << "---> Le Dump <---";	
 	output(versionParser);
 	
@@ -382,12 +388,15 @@ void V2::World::transcribeNeoCultures()
 
 void V2::World::importProvinces()
 {
-	auto provinceFilenames = discoverProvinceFilenames();
-	for (const auto& provinceFilename : provinceFilenames)
+	// Every province parses its own history file and only reads the mappers, so they are built in parallel.
+	const auto discoveredFilenames = discoverProvinceFilenames();
+	const std::vector<std::string> provinceFilenames(discoveredFilenames.begin(), discoveredFilenames.end());
+	std::vector<std::shared_ptr<Province>> builtProvinces(provinceFilenames.size());
+	helpers::ThreadPool::shared().parallelFor(provinceFilenames.size(), [this, &provinceFilenames, &builtProvinces](const size_t index)
 	{
-		auto newProvince = std::make_shared<Province>(provinceFilename, climateMapper, terrainDataMapper, provinceNameParser, navalBaseMapper);
-		provinces.insert(std::make_pair(newProvince->getID(), newProvince));
-	}
+		builtProvinces[index] = std::make_shared<Province>(provinceFilenames[index], climateMapper, terrainDataMapper, provinceNameParser, navalBaseMapper);
+	});
+	for (auto& newProvince: builtProvinces) provinces.insert(std::make_pair(newProvince->getID(), std::move(newProvince)));
 
 	if (theConfiguration.getRandomiseRgos())
 	{
@@ -783,9 +792,10 @@ void V2::World::convertProvinces(const EU4::World& sourceWorld, const mappers::T
 		// Before we convert a province, we need to filter those eu4 province sources belonging to another owner.
 		// ... don't want to influence development with filthy foreign manufactories and forts.
 		std::vector<std::shared_ptr<EU4::Province>> filteredSources;
+		const helpers::Symbol eu4OwnerSymbol(*eu4Owner);
 		for (const auto& eu4provID: eu4ProvinceNumbers)
 		{
-			if (sourceWorld.getProvince(eu4provID)->getOwnerString() == *eu4Owner)
+			if (sourceWorld.getProvince(eu4provID)->getOwnerSymbol() == eu4OwnerSymbol)
 			{
 				filteredSources.push_back(sourceWorld.getProvince(eu4provID));
 			}
@@ -803,7 +813,7 @@ void V2::World::convertProvinces(const EU4::World& sourceWorld, const mappers::T
 	}
 }
 
-std::optional<std::string> V2::World::determineProvinceOwnership(const std::vector<int>& eu4ProvinceNumbers, const EU4::World& sourceWorld) const
+std::optional<std::string> V2::World::determineProvinceOwnership(const helpers::Span<const int> eu4ProvinceNumbers, const EU4::World& sourceWorld) const
 {
 	// determine ownership by province development.
 	std::map<std::string, std::vector<std::shared_ptr<EU4::Province>>> theClaims; // tag, claimed provinces
@@ -812,7 +822,7 @@ std::optional<std::string> V2::World::determineProvinceOwnership(const std::vect
 	for (auto eu4ProvinceID : eu4ProvinceNumbers)
 	{
 		const auto& eu4province = sourceWorld.getProvince(eu4ProvinceID);
-		auto ownerTag = eu4province->getOwnerString();
+		const auto& ownerTag = eu4province->getOwnerString();
 		if (ownerTag.empty()) continue; // Don't touch un-colonized provinces.
 		theClaims[ownerTag].push_back(eu4province);
 		theShares[ownerTag] = std::make_pair(lround(eu4province->getTotalDevModifier()), lround(eu4province->getBaseTax()));
@@ -848,7 +858,7 @@ std::optional<std::string> V2::World::determineProvinceOwnership(const std::vect
 	return winner;
 }
 
-std::optional<std::string> V2::World::determineProvinceControllership(const std::vector<int>& eu4ProvinceNumbers, const EU4::World& sourceWorld)
+std::optional<std::string> V2::World::determineProvinceControllership(const helpers::Span<const int> eu4ProvinceNumbers, const EU4::World& sourceWorld)
 {
 	// determine ownership by pure numbers. Errors due to equal numbers can be assigned to war uncertainty and fog of war. *shrug*
 	std::map<std::string, std::vector<int>> theClaims; // tag, claimed provinces
@@ -856,7 +866,7 @@ std::optional<std::string> V2::World::determineProvinceControllership(const std:
 	for (auto eu4ProvinceID : eu4ProvinceNumbers)
 	{
 		const auto& eu4province = sourceWorld.getProvince(eu4ProvinceID);
-		auto controllerTag = eu4province->getControllerString();
+		const auto& controllerTag = eu4province->getControllerString();
 		if (controllerTag.empty()) continue; // Don't touch un-colonized provinces.
 		theClaims[controllerTag].push_back(eu4ProvinceID);
 	}